@@ -0,0 +1,290 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+// Benchmark de escalabilidad: corre ScreenSaver --bench (sin ventana) sobre
+// una cuadricula de particulas x hilos x longitud de estela x orbitas, con
+// semilla fija y frames de calentamiento. Cada punto se compara contra el
+// backend sequential (la version Secuencial) con los mismos parametros, y
+// se reporta el rendimiento, la aceleracion y la eficiencia paralela como
+// tabla en la salida estandar y como CSV.
+
+#include <vector> // Include vector header
+#include <string> // Include string header
+#include <sstream> // Include sstream header
+#include <fstream> // Include fstream header
+#include <iostream> // Include iostream header
+#include <iomanip> // Include iomanip header
+#include <algorithm> // Include algorithm header
+#include <thread> // Include thread header
+#include <cstdio> // Include cstdio header
+#include <cstdlib> // Include cstdlib header
+#include <exception> // Include exception header
+#include <initializer_list> // Include initializer list header
+
+namespace {
+
+// PARAMETROS DEL BARRIDO
+struct SweepOptions {
+    std::string program; // EJECUTABLE ScreenSaver
+    std::string backend = "openmp"; // BACKEND PARALELO A MEDIR
+    std::string render = "software"; // --bench-render
+    std::string csv = "scaling.csv"; // ARCHIVO CSV
+    std::vector<int> particles{1000, 10000, 100000, 1000000}; // PARTICULAS
+    std::vector<int> threads; // HILOS (POR DEFECTO 1, 2, 4... HASTA LOS DEL SISTEMA)
+    std::vector<int> trails{20}; // LONGITUDES DE ESTELA
+    std::vector<int> orbits{5}; // CANTIDADES DE ORBITAS
+    int frames = 200; // FRAMES MEDIDOS POR CORRIDA
+    int warmup = 20; // FRAMES DE CALENTAMIENTO POR CORRIDA
+    int repeat = 1; // CORRIDAS POR PUNTO (SE QUEDA LA MEDIANA)
+    std::string seed = "42"; // SEMILLA
+};
+
+// RESULTADO DE UNA CORRIDA
+struct RunResult {
+    bool ok = false; // LA CORRIDA TERMINO BIEN
+    double frameMs = 0; // DURACION PROMEDIO DEL FRAME (ms)
+    double particlesPerSec = 0; // PARTICULAS ACTUALIZADAS POR SEGUNDO
+};
+
+// FUNCION PARA LEER UN ENTERO EN [low, high] (IGUAL QUE LAS OPCIONES DE ScreenSaver)
+bool parseInt(const std::string& text, int low, int high, int& value) {
+    try {
+        size_t used = 0; // CARACTERES LEIDOS
+        long parsed = std::stol(text, &used);
+        if (used != text.size() || parsed < low || parsed > high) return false;
+        value = static_cast<int>(parsed);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+// FUNCION PARA LEER UNA LISTA "a,b,c" DE ENTEROS EN [low, high]
+bool parseIntList(const std::string& text, int low, int high, std::vector<int>& values) {
+    values.clear();
+    size_t begin = 0; // INICIO DEL ELEMENTO ACTUAL
+    while (true) {
+        size_t comma = text.find(',', begin); // FIN DEL ELEMENTO
+        int value; // ELEMENTO
+        if (!parseInt(text.substr(begin, comma - begin), low, high, value)) return false;
+        values.push_back(value);
+        if (comma == std::string::npos) return true;
+        begin = comma + 1;
+    }
+}
+
+// FUNCION PARA LEER UNA SEMILLA DE 64 BITS (SE GUARDA COMO TEXTO)
+bool parseSeed(const std::string& text, std::string& value) {
+    try {
+        size_t used = 0; // CARACTERES LEIDOS
+        if (text.empty() || text[0] == '-') return false;
+        std::stoull(text, &used);
+        if (used != text.size()) return false;
+        value = text;
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+// FUNCION PARA LEER UN VALOR QUE DEBE SER UNO DE choices
+bool parseChoice(const std::string& text, std::initializer_list<const char*> choices, std::string& value) {
+    for (const char* choice : choices) {
+        if (text == choice) {
+            value = text;
+            return true;
+        }
+    }
+    return false;
+}
+
+// FUNCION PARA PONER UN ARGUMENTO ENTRE COMILLAS SIMPLES PARA LA SHELL
+std::string quote(const std::string& text) {
+    std::string quoted = "'"; // ARGUMENTO ENTRE COMILLAS
+    for (char c : text) {
+        if (c == '\'') quoted += "'\\''"; // CERRAR, COMILLA ESCAPADA Y ABRIR
+        else quoted += c;
+    }
+    return quoted + "'";
+}
+
+// FUNCION PARA CORRER UNA VEZ EL BENCHMARK Y LEER SU REPORTE CSV
+RunResult runOnce(const SweepOptions& options, const std::string& backend, int threads, int particles, int trail,
+                  int orbits) {
+    std::ostringstream command; // LINEA DE COMANDOS (CADA ARGUMENTO ENTRE COMILLAS)
+    command << quote(options.program) << " --bench --bench-format csv"
+            << " --bench-frames " << quote(std::to_string(options.frames))
+            << " --bench-warmup " << quote(std::to_string(options.warmup))
+            << " --bench-render " << quote(options.render) << " --seed " << quote(options.seed)
+            << " --backend " << quote(backend) << " --threads " << quote(std::to_string(threads))
+            << " --particles " << quote(std::to_string(particles)) << " --trail-length " << quote(std::to_string(trail))
+            << " --orbits " << quote(std::to_string(orbits)) << " 2>/dev/null";
+
+    RunResult result; // RESULTADO
+    FILE* pipe = popen(command.str().c_str(), "r");
+    if (pipe == nullptr) return result;
+    std::string report; // SALIDA DEL PROGRAMA
+    char buffer[4096];
+    for (size_t n; (n = std::fread(buffer, 1, sizeof(buffer), pipe)) > 0;) report.append(buffer, n);
+    if (pclose(pipe) != 0) return result;
+
+    // FILAS "frame,mean,..." Y "particles_per_sec,valor,..."
+    bool haveFrame = false, haveRate = false;
+    std::istringstream lines(report); // FILAS DEL REPORTE
+    std::string line; // FILA ACTUAL
+    while (std::getline(lines, line)) {
+        std::string metric = line.substr(0, line.find(',')); // PRIMERA COLUMNA
+        const char* value = line.c_str() + std::min(line.size(), metric.size() + 1); // SEGUNDA COLUMNA
+        if (metric == "frame") {
+            result.frameMs = std::strtod(value, nullptr);
+            haveFrame = true;
+        } else if (metric == "particles_per_sec") {
+            result.particlesPerSec = std::strtod(value, nullptr);
+            haveRate = true;
+        }
+    }
+    result.ok = haveFrame && haveRate && result.frameMs > 0;
+    return result;
+}
+
+// FUNCION PARA CORRER repeat VECES Y QUEDARSE CON LA MEDIANA DEL FRAME
+RunResult run(const SweepOptions& options, const std::string& backend, int threads, int particles, int trail,
+              int orbits) {
+    std::vector<RunResult> runs; // CORRIDAS DEL PUNTO
+    for (int r = 0; r < options.repeat; ++r) {
+        RunResult result = runOnce(options, backend, threads, particles, trail, orbits);
+        if (!result.ok) return result;
+        runs.push_back(result);
+    }
+    std::sort(runs.begin(), runs.end(), [](const RunResult& a, const RunResult& b) { return a.frameMs < b.frameMs; });
+    return runs[runs.size() / 2];
+}
+
+// FUNCION PARA MOSTRAR LA AYUDA
+void printUsage(const char* program) {
+    std::cout << "Uso: " << program << " [opciones]\n"
+              << "  --program RUTA       ejecutable ScreenSaver (el que esta junto a este programa)\n"
+              << "  --backend MODO       backend paralelo: openmp, std o tasks (openmp)\n"
+              << "  --particles LISTA    particulas, separadas por comas (1000,10000,100000,1000000)\n"
+              << "  --threads LISTA      hilos (1,2,4... hasta los del sistema)\n"
+              << "  --trail-length LISTA longitudes de estela (20)\n"
+              << "  --orbits LISTA       cantidades de orbitas (5)\n"
+              << "  --frames N           frames medidos por corrida (200)\n"
+              << "  --warmup N           frames de calentamiento por corrida (20)\n"
+              << "  --repeat N           corridas por punto, se usa la mediana (1)\n"
+              << "  --render MODO        software o none (software)\n"
+              << "  --seed N             semilla (42)\n"
+              << "  --csv ARCHIVO        archivo CSV del reporte (scaling.csv)\n";
+}
+
+} // namespace
+
+int main(int argc, char* args[]) {
+    SweepOptions options; // PARAMETROS DEL BARRIDO
+    std::string self = args[0]; // RUTA DE ESTE PROGRAMA
+    size_t slash = self.find_last_of('/'); // CARPETA DE ESTE PROGRAMA
+    options.program = (slash == std::string::npos ? std::string(".") : self.substr(0, slash)) + "/ScreenSaver";
+    for (int t = 1; t <= static_cast<int>(std::max(1u, std::thread::hardware_concurrency())); t *= 2) {
+        options.threads.push_back(t);
+    }
+
+    // LEER OPCIONES
+    for (int i = 1; i < argc; ++i) {
+        std::string key = args[i]; // OPCION
+        if (key == "--help" || key == "-h") {
+            printUsage(args[0]);
+            return 0;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Falta el valor de " << key << "\n";
+            return 1;
+        }
+        std::string value = args[++i]; // VALOR
+        bool ok = true; // VALOR VALIDO
+        // LOS RANGOS SON LOS MISMOS QUE ACEPTA ScreenSaver
+        if (key == "--program") options.program = value;
+        else if (key == "--backend") ok = parseChoice(value, {"openmp", "std", "tasks"}, options.backend);
+        else if (key == "--render") ok = parseChoice(value, {"software", "none"}, options.render);
+        else if (key == "--seed") ok = parseSeed(value, options.seed);
+        else if (key == "--csv") options.csv = value;
+        else if (key == "--particles") ok = parseIntList(value, 1, 100000000, options.particles);
+        else if (key == "--threads") ok = parseIntList(value, 1, 1024, options.threads);
+        else if (key == "--trail-length") ok = parseIntList(value, 1, 1024, options.trails);
+        else if (key == "--orbits") ok = parseIntList(value, 1, 10000, options.orbits);
+        else if (key == "--frames") ok = parseInt(value, 1, 100000000, options.frames);
+        else if (key == "--warmup") ok = parseInt(value, 0, 100000000, options.warmup);
+        else if (key == "--repeat") ok = parseInt(value, 1, 1000, options.repeat);
+        else {
+            std::cerr << "Opcion desconocida: " << key << "\n";
+            return 1;
+        }
+        if (!ok) {
+            std::cerr << key << " " << value << ": valor invalido\n";
+            return 1;
+        }
+    }
+
+    std::ofstream csv(options.csv); // REPORTE CSV
+    if (!csv) {
+        std::cerr << "No se pudo abrir " << options.csv << "\n";
+        return 1;
+    }
+    csv << "particles,trail_length,orbits,backend,threads,frame_ms,fps,particles_per_sec,speedup,efficiency\n";
+    csv << std::fixed << std::setprecision(4);
+
+    std::cout << std::left << std::setw(10) << "particles" << std::setw(7) << "trail" << std::setw(8) << "orbits"
+              << std::setw(12) << "backend" << std::setw(9) << "threads" << std::right << std::setw(12) << "frame ms"
+              << std::setw(10) << "fps" << std::setw(14) << "Mparticles/s" << std::setw(9) << "speedup"
+              << std::setw(12) << "efficiency" << "\n";
+    std::cout << std::fixed;
+
+    // FUNCION PARA ESCRIBIR UNA FILA EN LA TABLA Y EN EL CSV
+    auto report = [&](int particles, int trail, int orbits, const std::string& backend, int threads,
+                      const RunResult& result, double baselineMs) {
+        double speedup = baselineMs / result.frameMs; // ACELERACION CONTRA sequential
+        double efficiency = speedup / threads; // EFICIENCIA PARALELA
+        std::cout << std::left << std::setw(10) << particles << std::setw(7) << trail << std::setw(8) << orbits
+                  << std::setw(12) << backend << std::setw(9) << threads << std::right << std::setprecision(3)
+                  << std::setw(12) << result.frameMs << std::setprecision(1) << std::setw(10)
+                  << 1000.0 / result.frameMs << std::setprecision(2) << std::setw(14)
+                  << result.particlesPerSec / 1e6 << std::setw(9) << speedup << std::setw(12) << efficiency
+                  << std::endl;
+        csv << particles << ',' << trail << ',' << orbits << ',' << backend << ',' << threads << ','
+            << result.frameMs << ',' << 1000.0 / result.frameMs << ',' << result.particlesPerSec << ',' << speedup
+            << ',' << efficiency << '\n';
+    };
+
+    // RECORRER LA CUADRICULA; LA BASE DE CADA PUNTO ES sequential CON UN HILO
+    int failures = 0; // CORRIDAS QUE FALLARON
+    for (int particles : options.particles) {
+        for (int trail : options.trails) {
+            for (int orbits : options.orbits) {
+                RunResult baseline = run(options, "sequential", 1, particles, trail, orbits);
+                if (!baseline.ok) {
+                    std::cerr << "Fallo la corrida sequential con " << particles << " particulas\n";
+                    failures++;
+                    continue;
+                }
+                report(particles, trail, orbits, "sequential", 1, baseline, baseline.frameMs);
+                for (int threads : options.threads) {
+                    RunResult result = run(options, options.backend, threads, particles, trail, orbits);
+                    if (!result.ok) {
+                        std::cerr << "Fallo la corrida " << options.backend << " con " << threads << " hilos y "
+                                  << particles << " particulas\n";
+                        failures++;
+                        continue;
+                    }
+                    report(particles, trail, orbits, options.backend, threads, result, baseline.frameMs);
+                }
+            }
+        }
+    }
+
+    std::cout << "CSV: " << options.csv << "\n";
+    return failures == 0 ? 0 : 1;
+}
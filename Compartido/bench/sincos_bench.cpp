@@ -0,0 +1,175 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+// Benchmark del seno y coseno de la orbita: compara la precision y el
+// rendimiento de std::cos/std::sin, del polinomio en float (escalar y SIMD) y
+// de la rotacion incremental, y mide cuanto se desvia la rotacion despues de
+// muchos frames.
+
+#include <vector> // Include vector header
+#include <cmath> // Include cmath header
+#include <chrono> // Include chrono header
+#include <cstdio> // Include cstdio header
+#include <cstdlib> // Include cstdlib header
+#include <cstring> // Include cstring header
+#include <algorithm> // Include algorithm header
+#include "fast_math.h" // Include fast math header
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float ORBIT_SPEED = 0.02f; // VELOCIDAD DE ORBITA POR DEFECTO
+constexpr double TWO_PI = 6.283185307179586476925;
+
+// EVITA QUE EL COMPILADOR ELIMINE EL TRABAJO MEDIDO
+volatile float sink;
+
+// FUNCION PARA MEDIR NANOSEGUNDOS POR PAR (SENO, COSENO)
+template <typename F>
+double measure(const std::vector<float>& angles, int repetitions, F&& body) {
+    auto start = Clock::now();
+    for (int rep = 0; rep < repetitions; ++rep) {
+        body();
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    return ns / (static_cast<double>(angles.size()) * repetitions);
+}
+
+int main(int argc, char* args[]) {
+    size_t count = argc > 1 ? std::strtoul(args[1], nullptr, 10) : 1 << 16; // ANGULOS POR REPETICION
+    int repetitions = argc > 2 ? std::atoi(args[2]) : 200; // REPETICIONES
+    long steps = argc > 3 ? std::atol(args[3]) : 1000000; // FRAMES PARA MEDIR LA DESVIACION
+
+    // ANGULOS EN [0, 2 PI), COMO LOS DE LAS ORBITAS
+    std::vector<float> angles(count), sines(count), cosines(count);
+    for (size_t i = 0; i < count; ++i) {
+        angles[i] = static_cast<float>(TWO_PI * (i + 0.5) / count);
+    }
+
+    // PRECISION CONTRA std::sin / std::cos EN DOUBLE
+    double libmError = 0, polyError = 0;
+    for (size_t i = 0; i < count; ++i) {
+        double a = angles[i];
+        float s, c;
+        fastmath::sincos(angles[i], s, c);
+        polyError = std::max({polyError, std::fabs(s - std::sin(a)), std::fabs(c - std::cos(a))});
+        libmError = std::max({libmError, std::fabs(std::sin(angles[i]) - std::sin(a)),
+                              std::fabs(std::cos(angles[i]) - std::cos(a))});
+    }
+
+    // DESVIACION DE LA ROTACION INCREMENTAL DESPUES DE steps FRAMES
+    float rc = 1, rs = 0; // CON NORMALIZACION
+    float uc = 1, us = 0; // SIN NORMALIZACION
+    float angle = 0; // ANGULO ACUMULADO EN FLOAT (COMO EL MODO POLY)
+    const float cosStep = std::cos(ORBIT_SPEED), sinStep = std::sin(ORBIT_SPEED);
+    for (long k = 0; k < steps; ++k) {
+        fastmath::rotate(rc, rs, cosStep, sinStep);
+        float nc = uc * cosStep - us * sinStep;
+        us = us * cosStep + uc * sinStep;
+        uc = nc;
+        angle += ORBIT_SPEED;
+        if (angle > 6.28318530717958647692f) angle -= 6.28318530717958647692f;
+    }
+    double exact = std::fmod(static_cast<double>(ORBIT_SPEED) * steps, TWO_PI); // ANGULO EXACTO
+    double rotationDrift = std::hypot(rc - std::cos(exact), rs - std::sin(exact));
+    double rawDrift = std::hypot(uc - std::cos(exact), us - std::sin(exact));
+    double angleDrift = std::hypot(std::cos(angle) - std::cos(exact), std::sin(angle) - std::sin(exact));
+    double rotationNorm = std::fabs(std::hypot(rc, rs) - 1.0), rawNorm = std::fabs(std::hypot(uc, us) - 1.0);
+
+    // RENDIMIENTO
+    double libmNs = measure(angles, repetitions, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            sines[i] = std::sin(angles[i]);
+            cosines[i] = std::cos(angles[i]);
+        }
+        sink = sines[count / 2] + cosines[count / 3];
+    });
+    double polyNs = measure(angles, repetitions, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            fastmath::sincos(angles[i], sines[i], cosines[i]);
+        }
+        sink = sines[count / 2] + cosines[count / 3];
+    });
+    double rotationNs = measure(angles, repetitions, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            fastmath::rotate(cosines[i], sines[i], cosStep, sinStep);
+        }
+        sink = sines[count / 2] + cosines[count / 3];
+    });
+    // KERNELS SIMD: CADA UNO MIDE SU PROPIO ERROR CONTRA std::sin / std::cos Y
+    // CUENTA LOS RESULTADOS QUE NO SON IGUALES BIT A BIT A LOS DEL ESCALAR
+    struct SimdRow {
+        const char* name; // KERNEL
+        double ns; // NANOSEGUNDOS POR PAR
+        double error; // ERROR ABSOLUTO MAXIMO
+        size_t mismatches; // RESULTADOS DISTINTOS AL ESCALAR
+    };
+    std::vector<SimdRow> simdRows; // KERNELS SOPORTADOS POR ESTE PROCESADOR
+
+    // FUNCION PARA REVISAR LOS RESULTADOS QUE QUEDARON EN sines Y cosines
+    auto checkSimd = [&](const char* name, double ns) {
+        SimdRow row{name, ns, 0, 0};
+        for (size_t i = 0; i < count; ++i) {
+            double a = angles[i];
+            float s, c;
+            fastmath::sincos(angles[i], s, c);
+            row.error = std::max({row.error, std::fabs(sines[i] - std::sin(a)), std::fabs(cosines[i] - std::cos(a))});
+            if (std::memcmp(&s, &sines[i], sizeof(float)) != 0 || std::memcmp(&c, &cosines[i], sizeof(float)) != 0) {
+                row.mismatches++;
+            }
+        }
+        simdRows.push_back(row);
+    };
+#ifdef FAST_MATH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        auto avx2 = [&]() __attribute__((target("avx2"))) {
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 s, c;
+                fastmath::sincos8(_mm256_loadu_ps(&angles[i]), s, c);
+                _mm256_storeu_ps(&sines[i], s);
+                _mm256_storeu_ps(&cosines[i], c);
+            }
+            for (; i < count; ++i) fastmath::sincos(angles[i], sines[i], cosines[i]);
+            sink = sines[count / 2] + cosines[count / 3];
+        };
+        checkSimd("avx2", measure(angles, repetitions, avx2));
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        auto sse41 = [&]() __attribute__((target("sse4.1"))) {
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 s, c;
+                fastmath::sincos4(_mm_loadu_ps(&angles[i]), s, c);
+                _mm_storeu_ps(&sines[i], s);
+                _mm_storeu_ps(&cosines[i], c);
+            }
+            for (; i < count; ++i) fastmath::sincos(angles[i], sines[i], cosines[i]);
+            sink = sines[count / 2] + cosines[count / 3];
+        };
+        checkSimd("sse4.1", measure(angles, repetitions, sse41));
+    }
+#endif
+
+    std::printf("angles: %zu x %d repetitions, drift after %ld frames of %.3f rad\n\n",
+                count, repetitions, steps, ORBIT_SPEED);
+    std::printf("%-22s %12s %14s %16s\n", "method", "ns/sincos", "max abs error", "!= poly scalar");
+    std::printf("%-22s %12.3f %14.3e %16s\n", "libm (float)", libmNs, libmError, "-");
+    std::printf("%-22s %12.3f %14.3e %16s\n", "poly (scalar)", polyNs, polyError, "-");
+    for (const SimdRow& row : simdRows) {
+        char label[32];
+        std::snprintf(label, sizeof(label), "poly (%s)", row.name);
+        std::printf("%-22s %12.3f %14.3e %16zu\n", label, row.ns, row.error, row.mismatches);
+    }
+    std::printf("%-22s %12.3f %14s %16s\n\n", "rotation", rotationNs, "see drift", "-");
+    std::printf("%-34s %14s %14s\n", "drift", "position error", "|norm - 1|");
+    std::printf("%-34s %14.3e %14s\n", "float angle accumulation", angleDrift, "-");
+    std::printf("%-34s %14.3e %14.3e\n", "rotation, renormalized", rotationDrift, rotationNorm);
+    std::printf("%-34s %14.3e %14.3e\n", "rotation, no renormalization", rawDrift, rawNorm);
+    return 0;
+}
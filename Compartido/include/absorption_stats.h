@@ -0,0 +1,65 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <atomic> // Include atomic header
+#include <cstddef> // Include cstddef header
+#include <cstdint> // Include cstdint header
+#include <new> // Include new header
+#include <vector> // Include vector header
+
+// Cuenta las particulas que absorbe cada orbita. Durante la actualizacion cada
+// hilo suma en sus propios contadores, un tramo de un solo arreglo alineado a
+// 64 bytes con un tamano multiplo de 8 contadores, asi que cada tramo empieza
+// en una linea de cache distinta (sin carreras y sin false sharing). Al
+// terminar el frame un solo hilo los suma a los totales, que se pueden leer
+// desde otro hilo (el que dibuja con --pipeline) sin detener la simulacion.
+class AbsorptionStats {
+public:
+    explicit AbsorptionStats(int orbitCount);
+
+    // FUNCION PARA PONER EN CERO LOS CONTADORES DE threads HILOS
+    void beginFrame(int threads);
+
+    // CONTADORES DEL HILO thread, UNO POR ORBITA
+    uint64_t* local(int thread) { return counts.data() + static_cast<size_t>(thread) * stride; }
+
+    // FUNCION PARA SUMAR LOS CONTADORES DE TODOS LOS HILOS A LOS TOTALES
+    void endFrame();
+
+    // CANTIDAD DE ORBITAS
+    int orbitCount() const { return orbits; }
+
+    // PARTICULAS QUE HA ABSORBIDO LA ORBITA orbit DESDE EL INICIO
+    uint64_t total(int orbit) const { return totals[orbit].load(std::memory_order_relaxed); }
+
+    // FUNCION PARA CALCULAR LAS ABSORCIONES POR SEGUNDO DE CADA ORBITA DESDE
+    // LA LECTURA ANTERIOR (last GUARDA LOS TOTALES DE ESA LECTURA)
+    std::vector<double> ratesSince(std::vector<uint64_t>& last, double seconds) const;
+
+private:
+    // ASIGNADOR QUE ALINEA EL ARREGLO AL INICIO DE UNA LINEA DE CACHE
+    template <typename T>
+    struct CacheAligned {
+        using value_type = T;
+        CacheAligned() = default;
+        template <typename U>
+        CacheAligned(const CacheAligned<U>&) {}
+        T* allocate(size_t n) { return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{64})); }
+        void deallocate(T* p, size_t) { ::operator delete(p, std::align_val_t{64}); }
+        bool operator==(const CacheAligned&) const { return true; }
+        bool operator!=(const CacheAligned&) const { return false; }
+    };
+
+    int orbits; // CANTIDAD DE ORBITAS
+    size_t stride; // CONTADORES POR HILO (MULTIPLO DE 8, UNA LINEA DE CACHE)
+    int threads = 0; // HILOS DEL FRAME ACTUAL
+    std::vector<uint64_t, CacheAligned<uint64_t>> counts; // CONTADORES DE TODOS LOS HILOS
+    std::vector<std::atomic<uint64_t>> totals; // TOTALES POR ORBITA
+};
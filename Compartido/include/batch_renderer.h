@@ -0,0 +1,42 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <SDL2/SDL.h> // Include SDL2 header
+#include <vector> // Include vector header
+#include "particle_system.h" // Include particle system header
+
+// Dibujo por lotes con el renderizador de SDL, para cuando subir una textura
+// completa cada frame es lento. Las orbitas ya vienen en el fondo
+// (OrbitBackground), aqui solo se dibujan las estelas. En vez de una llamada
+// por punto:
+//  - drawPoints agrupa los puntos por color y alfa cuantizados (3 bits por
+//    canal, 4 niveles de alfa) y manda cada grupo con un SDL_RenderDrawPoints.
+//  - drawGeometry arma un solo buffer de vertices (un cuadrado de 1 pixel por
+//    punto, con el color exacto en cada vertice) y lo manda con un
+//    SDL_RenderGeometry. Necesita SDL 2.0.18; con versiones anteriores usa
+//    drawPoints.
+class BatchRenderer {
+public:
+    // FUNCION PARA DIBUJAR LAS ESTELAS CON SDL_RenderDrawPoints (blend: VER
+    // ParticleSystem::renderPoint)
+    void drawPoints(SDL_Renderer* renderer, const ParticleSystem& ps, int trailLength, float blend = 1.0f);
+
+    // FUNCION PARA DIBUJAR LAS ESTELAS CON UN SOLO SDL_RenderGeometry
+    void drawGeometry(SDL_Renderer* renderer, const ParticleSystem& ps, int trailLength, float blend = 1.0f);
+
+private:
+    static constexpr int COLOR_BITS = 3; // BITS POR CANAL AL CUANTIZAR
+    static constexpr int ALPHA_LEVELS = 4; // NIVELES DE ALFA AL CUANTIZAR
+    static constexpr int BUCKET_COUNT = (1 << (3 * COLOR_BITS)) * ALPHA_LEVELS; // CANTIDAD DE GRUPOS
+
+    std::vector<std::vector<SDL_Point>> buckets; // PUNTOS POR GRUPO
+    std::vector<SDL_Vertex> vertices; // VERTICES DEL LOTE DE GEOMETRIA
+    std::vector<int> indices; // INDICES DEL LOTE DE GEOMETRIA
+};
@@ -0,0 +1,120 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <array> // Include array header
+#include <chrono> // Include chrono header
+#include <cstdint> // Include cstdint header
+#include <ostream> // Include ostream header
+#include <string> // Include string header
+#include <vector> // Include vector header
+
+// Modo benchmark (--bench): corre una cantidad fija de frames sin ventana,
+// mide cuanto tarda cada fase del ciclo principal y al final escribe un
+// resumen en JSON o CSV para poder comparar corridas en los servidores.
+
+// FORMATOS DEL REPORTE
+enum BenchFormat {
+    BENCH_JSON = 0,
+    BENCH_CSV = 1
+};
+
+// FASES DEL CICLO PRINCIPAL
+enum BenchPhase {
+    PHASE_UPDATE = 0, // ACTUALIZAR PARTICULAS
+    PHASE_RENDER, // DIBUJAR EL FRAME
+    PHASE_RESPAWN, // AGREGAR PARTICULAS NUEVAS
+    PHASE_PRESENT, // MOSTRAR EL FRAME
+    PHASE_PUBLISH, // COPIAR EL ESTADO PARA EL HILO QUE DIBUJA (--pipeline)
+    PHASE_GRAPH, // ACTUALIZAR, DIBUJAR Y AGREGAR COMO UN SOLO GRAFO (--backend tasks)
+    PHASE_COUNT
+};
+
+// OPCIONES DEL MODO BENCHMARK
+struct BenchOptions {
+    bool enabled = false; // CORRER EN MODO BENCHMARK
+    int frames = 1000; // FRAMES A MEDIR
+    int warmup = 0; // FRAMES QUE SE CORREN ANTES DE EMPEZAR A MEDIR
+    bool render = true; // RASTERIZAR POR SOFTWARE CADA FRAME
+    int format = BENCH_JSON; // FORMATO DEL REPORTE (BenchFormat)
+    std::string output; // ARCHIVO DEL REPORTE (VACIO: SALIDA ESTANDAR)
+    std::vector<int> snapshotFrames; // FRAMES EN LOS QUE SE TOMA UNA FOTO (snapshot.h)
+    std::string snapshotDir; // CARPETA DONDE SE GUARDAN LAS FOTOS (VACIO: NO SE GUARDAN)
+    std::string goldenDir; // CARPETA CON LAS FOTOS DE REFERENCIA (VACIO: NO SE COMPARA)
+    float goldenPosition = 0.5f; // DIFERENCIA MAXIMA DE POSICION (PIXELES)
+    int goldenChannel = 2; // DIFERENCIA MAXIMA POR CANAL DE COLOR
+    float goldenMaxDiff = 0.001f; // FRACCION DE PARTICULAS O PIXELES QUE PUEDEN PASARSE
+};
+
+// DATOS DE LA CORRIDA QUE VAN EN EL REPORTE
+struct BenchInfo {
+    const char* backend; // VERSION DEL PROGRAMA
+    int threads; // HILOS USADOS
+    uint64_t seed; // SEMILLA
+    int particles; // PARTICULAS OBJETIVO
+    const char* kernel; // KERNEL DE MOVIMIENTO
+    const char* schedule; // REPARTO DEL CICLO DE ACTUALIZACION
+    int chunk; // BLOQUES POR PEDAZO (0: EL VALOR POR DEFECTO)
+    bool render; // SE DIBUJO CADA FRAME
+    std::vector<uint64_t> absorptions; // PARTICULAS ABSORBIDAS POR CADA ORBITA
+};
+
+// TIEMPOS DE CADA FASE DE UN FRAME (ms)
+using PhaseTimes = std::array<double, PHASE_COUNT>;
+
+// CRONOMETRO POR VUELTAS PARA MEDIR FASES CONSECUTIVAS
+class PhaseTimer {
+public:
+    PhaseTimer() : last(std::chrono::steady_clock::now()) {}
+
+    // FUNCION PARA OBTENER LOS ms DESDE LA VUELTA ANTERIOR Y EMPEZAR OTRA
+    double lap() {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double, std::milli>(now - last).count();
+        last = now;
+        return elapsed;
+    }
+
+private:
+    std::chrono::steady_clock::time_point last; // FIN DE LA VUELTA ANTERIOR
+};
+
+// Guarda la duracion de cada fase de hasta maxFrames frames. Las fases se
+// miden con PhaseTimer, incluso desde otro hilo, y se suman al frame actual;
+// la duracion del frame va de beginFrame a endFrame. Con --pipeline las
+// fases se solapan y su suma puede ser mayor que el frame.
+class BenchRecorder {
+public:
+    explicit BenchRecorder(int maxFrames);
+
+    // FUNCION PARA EMPEZAR A MEDIR UN FRAME
+    void beginFrame();
+
+    // FUNCION PARA SUMAR TIEMPO A UNA FASE DEL FRAME ACTUAL
+    void addPhase(BenchPhase phase, double ms) { current[phase] += ms; }
+
+    // FUNCION PARA SUMAR LOS TIEMPOS DE VARIAS FASES AL FRAME ACTUAL
+    void addPhases(const PhaseTimes& times);
+
+    // FUNCION PARA TERMINAR EL FRAME ACTUAL
+    void endFrame(size_t particleCount);
+
+    // FUNCION PARA ESCRIBIR EL RESUMEN DE LA CORRIDA
+    void write(std::ostream& out, int format, const BenchInfo& info) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    size_t maxFrames; // FRAMES A GUARDAR
+    Clock::time_point frameStart; // INICIO DEL FRAME
+    PhaseTimes current{}; // FASES DEL FRAME ACTUAL (ms)
+    std::vector<PhaseTimes> phases; // FASES DE CADA FRAME (ms)
+    std::vector<double> frameTimes; // DURACION DE CADA FRAME (ms)
+    uint64_t particleUpdates = 0; // PARTICULAS ACTUALIZADAS EN TOTAL
+};
@@ -0,0 +1,61 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <cstddef> // Include cstddef header
+#include <functional> // Include functional header
+#include "task_pool.h" // Include task pool header
+
+// Backends de ejecucion. Todos los ciclos paralelos de la simulacion y del
+// rasterizador pasan por parallelFor, que reparte los indices segun el
+// backend elegido con --backend (settings.h):
+//  - sequential: todo en el hilo que llama, en orden.
+//  - openmp: un #pragma omp parallel for; el ciclo de actualizacion usa el
+//    reparto de --schedule y --chunk, los demas un reparto static fijo.
+//  - std: std::for_each con std::execution::par sobre rangos contiguos.
+//  - tasks: pedazos como tareas en un pool persistente con robo de trabajo
+//    (task_pool.h); el frame completo tambien se puede correr como un grafo.
+// Los que no se compilaron (sin OpenMP o sin <execution>) no se pueden elegir.
+enum ExecutionBackend {
+    BACKEND_SEQUENTIAL = 0, // UN SOLO HILO
+    BACKEND_OPENMP = 1, // OPENMP
+    BACKEND_STD = 2, // ALGORITMOS PARALELOS DE C++17
+    BACKEND_TASKS = 3 // POOL DE TAREAS CON ROBO DE TRABAJO
+};
+
+// FUNCION PARA SABER SI UN BACKEND ESTA COMPILADO EN ESTE PROGRAMA
+bool backendAvailable(int backend);
+
+// FUNCION PARA OBTENER EL NOMBRE DE UN BACKEND
+const char* backendName(int backend);
+
+// FUNCION PARA OBTENER CUANTOS TRABAJADORES USA EL BACKEND ACTUAL
+int backendWorkers();
+
+// FUNCION PARA LIMITAR CUANTOS TRABAJADORES CORREN A LA VEZ (0: TODOS). LOS
+// NUMEROS DE TRABAJADOR SIGUEN ENTRE 0 Y backendWorkers()-1, ASI QUE LO QUE
+// SE RESERVO POR TRABAJADOR SIGUE SIRVIENDO
+void backendSetActiveWorkers(int workers);
+
+// FUNCION PARA OBTENER CUANTOS TRABAJADORES CORREN A LA VEZ
+int backendActiveWorkers();
+
+// FUNCION PARA OBTENER EL POOL DEL BACKEND tasks (SE CREA LA PRIMERA VEZ)
+TaskPool& backendPool();
+
+// REPARTO DE UN CICLO DE parallelFor
+enum LoopSchedule {
+    LOOP_FIXED = 0, // REPARTO FIJO (static EN OPENMP, PEDAZOS POR DEFECTO EN tasks)
+    LOOP_TUNED = 1 // REPARTO DE --schedule Y --chunk (SOLO EL CICLO DE ACTUALIZACION)
+};
+
+// FUNCION PARA LLAMAR body(i, trabajador) PARA CADA i EN [0, count). EL
+// TRABAJADOR (0..backendWorkers()-1) CORRE UN SOLO i A LA VEZ, ASI QUE PUEDE
+// ESCRIBIR EN SUS PROPIOS CONTADORES SIN CANDADOS
+void parallelFor(size_t count, const std::function<void(size_t, int)>& body, LoopSchedule schedule = LOOP_FIXED);
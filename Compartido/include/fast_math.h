@@ -0,0 +1,115 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <cmath> // Include cmath header
+#include <cstdint> // Include cstdint header
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h> // Include x86 intrinsics header
+#define FAST_MATH_X86 1
+#endif
+
+// Seno y coseno en float con polinomios (coeficientes minimax de Cephes). El
+// angulo se reduce a [-PI/4, PI/4] con la separacion de Cody-Waite de PI/2, y
+// el cuadrante decide el intercambio y los signos. El error absoluto es menor
+// a 1e-6 para angulos de magnitud moderada. No usa ramas ni tablas, asi que
+// las versiones SIMD calculan 4 u 8 angulos a la vez con el mismo resultado
+// que la version escalar.
+
+namespace fastmath {
+
+constexpr float TWO_OVER_PI = 0.636619772367581343f; // 2 / PI
+constexpr float PIO2_1 = 1.5703125f; // PI / 2, PARTE ALTA
+constexpr float PIO2_2 = 4.837512969970703125e-4f; // PI / 2, PARTE MEDIA
+constexpr float PIO2_3 = 7.54978995489188216e-8f; // PI / 2, PARTE BAJA
+constexpr float SIN_C1 = -1.6666654611e-1f; // COEFICIENTES DEL SENO
+constexpr float SIN_C2 = 8.3321608736e-3f;
+constexpr float SIN_C3 = -1.9515295891e-4f;
+constexpr float COS_C1 = 4.166664568298827e-2f; // COEFICIENTES DEL COSENO
+constexpr float COS_C2 = -1.388731625493765e-3f;
+constexpr float COS_C3 = 2.443315711809948e-5f;
+
+// FUNCION PARA CALCULAR SENO Y COSENO DE UN ANGULO (VERSION ESCALAR)
+inline void sincos(float a, float& s, float& c) {
+    float j = std::nearbyint(a * TWO_OVER_PI); // CUADRANTE
+    int q = static_cast<int>(j);
+    float r = ((a - j * PIO2_1) - j * PIO2_2) - j * PIO2_3; // ANGULO REDUCIDO
+    float r2 = r * r;
+    float sr = r + r * r2 * (SIN_C1 + r2 * (SIN_C2 + r2 * SIN_C3)); // SENO DEL REDUCIDO
+    float cr = 1.0f - 0.5f * r2 + r2 * r2 * (COS_C1 + r2 * (COS_C2 + r2 * COS_C3)); // COSENO DEL REDUCIDO
+    bool swap = (q & 1) != 0; // CUADRANTES IMPARES INTERCAMBIAN SENO Y COSENO
+    s = swap ? cr : sr;
+    c = swap ? sr : cr;
+    if (q & 2) s = -s;
+    if ((q + 1) & 2) c = -c;
+}
+
+#ifdef FAST_MATH_X86
+
+// FUNCION PARA CALCULAR SENO Y COSENO DE 8 ANGULOS (AVX2)
+__attribute__((target("avx2"))) inline void sincos8(__m256 a, __m256& s, __m256& c) {
+    __m256 j = _mm256_round_ps(_mm256_mul_ps(a, _mm256_set1_ps(TWO_OVER_PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256i q = _mm256_cvtps_epi32(j);
+    __m256 r = _mm256_sub_ps(a, _mm256_mul_ps(j, _mm256_set1_ps(PIO2_1)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(j, _mm256_set1_ps(PIO2_2)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(j, _mm256_set1_ps(PIO2_3)));
+    __m256 r2 = _mm256_mul_ps(r, r);
+    __m256 sp = _mm256_add_ps(_mm256_set1_ps(SIN_C2), _mm256_mul_ps(r2, _mm256_set1_ps(SIN_C3)));
+    sp = _mm256_add_ps(_mm256_set1_ps(SIN_C1), _mm256_mul_ps(r2, sp));
+    __m256 sr = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, r2), sp));
+    __m256 cp = _mm256_add_ps(_mm256_set1_ps(COS_C2), _mm256_mul_ps(r2, _mm256_set1_ps(COS_C3)));
+    cp = _mm256_add_ps(_mm256_set1_ps(COS_C1), _mm256_mul_ps(r2, cp));
+    __m256 cr = _mm256_add_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(0.5f), r2)),
+                              _mm256_mul_ps(_mm256_mul_ps(r2, r2), cp));
+    const __m256i one = _mm256_set1_epi32(1), two = _mm256_set1_epi32(2);
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, one), one));
+    __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, two), 30));
+    __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, one), two), 30));
+    s = _mm256_xor_ps(_mm256_blendv_ps(sr, cr, swap), sinSign);
+    c = _mm256_xor_ps(_mm256_blendv_ps(cr, sr, swap), cosSign);
+}
+
+// FUNCION PARA CALCULAR SENO Y COSENO DE 4 ANGULOS (SSE4.1)
+__attribute__((target("sse4.1"))) inline void sincos4(__m128 a, __m128& s, __m128& c) {
+    __m128 j = _mm_round_ps(_mm_mul_ps(a, _mm_set1_ps(TWO_OVER_PI)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m128i q = _mm_cvtps_epi32(j);
+    __m128 r = _mm_sub_ps(a, _mm_mul_ps(j, _mm_set1_ps(PIO2_1)));
+    r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(PIO2_2)));
+    r = _mm_sub_ps(r, _mm_mul_ps(j, _mm_set1_ps(PIO2_3)));
+    __m128 r2 = _mm_mul_ps(r, r);
+    __m128 sp = _mm_add_ps(_mm_set1_ps(SIN_C2), _mm_mul_ps(r2, _mm_set1_ps(SIN_C3)));
+    sp = _mm_add_ps(_mm_set1_ps(SIN_C1), _mm_mul_ps(r2, sp));
+    __m128 sr = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), sp));
+    __m128 cp = _mm_add_ps(_mm_set1_ps(COS_C2), _mm_mul_ps(r2, _mm_set1_ps(COS_C3)));
+    cp = _mm_add_ps(_mm_set1_ps(COS_C1), _mm_mul_ps(r2, cp));
+    __m128 cr = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_set1_ps(0.5f), r2)),
+                           _mm_mul_ps(_mm_mul_ps(r2, r2), cp));
+    const __m128i one = _mm_set1_epi32(1), two = _mm_set1_epi32(2);
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+    __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30));
+    __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30));
+    s = _mm_xor_ps(_mm_blendv_ps(sr, cr, swap), sinSign);
+    c = _mm_xor_ps(_mm_blendv_ps(cr, sr, swap), cosSign);
+}
+
+#endif // FAST_MATH_X86
+
+// FUNCION PARA ROTAR EL PAR (c, s) POR LA ROTACION (cosStep, sinStep). LA
+// CORRECCION DE NEWTON DEVUELVE EL PAR AL CIRCULO UNITARIO PARA QUE EL ERROR
+// DE REDONDEO NO SE ACUMULE DE FRAME EN FRAME
+inline void rotate(float& c, float& s, float cosStep, float sinStep) {
+    float nc = c * cosStep - s * sinStep; // COSENO ROTADO
+    float ns = s * cosStep + c * sinStep; // SENO ROTADO
+    float k = 1.5f - 0.5f * (nc * nc + ns * ns); // FACTOR DE NORMALIZACION
+    c = nc * k;
+    s = ns * k;
+}
+
+} // namespace fastmath
@@ -0,0 +1,41 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <cstdint> // Include cstdint header
+
+// Paso de tiempo fijo (--sim-rate). Cada paso de la simulacion avanza una
+// cantidad fija (ORBIT_SPEED, dx, dy), asi que con un paso por frame la
+// velocidad dependia de los FPS. Aqui el tiempo real de cada frame se junta
+// en un acumulador y se corren los pasos de 1 / rate segundos que quepan
+// (0, 1 o varios). Si caben mas de maxSubsteps se descartan los que sobran,
+// para que un frame lento no haga mas lentos a los siguientes. Lo que queda
+// en el acumulador (blend) sirve para interpolar el dibujo entre los dos
+// ultimos pasos.
+class FixedTimestep {
+public:
+    FixedTimestep(double rate, int maxSubsteps);
+
+    // FUNCION PARA SUMAR seconds AL ACUMULADOR Y OBTENER LOS PASOS A CORRER
+    int advance(double seconds);
+
+    // FRACCION DE PASO QUE QUEDO EN EL ACUMULADOR (0..1)
+    float blend() const { return static_cast<float>(accumulator / step); }
+
+    // PASOS CORRIDOS Y DESCARTADOS DESDE EL INICIO
+    uint64_t steps() const { return stepCount; }
+    uint64_t dropped() const { return droppedCount; }
+
+private:
+    double step; // DURACION DE UN PASO (s)
+    int maxSubsteps; // PASOS MAXIMOS POR FRAME
+    double accumulator = 0; // TIEMPO SIN SIMULAR (s)
+    uint64_t stepCount = 0; // PASOS CORRIDOS
+    uint64_t droppedCount = 0; // PASOS DESCARTADOS
+};
@@ -0,0 +1,73 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <condition_variable> // Include condition variable header
+#include <functional> // Include functional header
+#include <mutex> // Include mutex header
+#include <thread> // Include thread header
+#include "bench.h" // Include bench header
+#include "particle_system.h" // Include particle system header
+
+// Simulacion y dibujo en paralelo (--pipeline). Un hilo simula el frame N+1
+// sobre el estado vivo mientras el hilo principal dibuja y presenta el
+// frame N desde una copia, asi el frame tarda cerca de max(simular, dibujar)
+// en lugar de la suma y esperar al vsync no detiene la simulacion.
+//
+// Hay tres copias del estado: back (la llena el simulador), ready (el frame
+// publicado, a lo mucho uno) y front (la que se esta dibujando). Publicar y
+// tomar un frame solo intercambia copias bajo el mutex. El simulador nunca se
+// adelanta mas de un frame publicado al que se dibuja.
+//
+// Las copias solo tienen lo que leen el dibujo y las fotos (posiciones,
+// colores, estados y estelas). Cada paso agrega a lo mucho un punto por
+// estela, asi que al publicar solo se copian los puntos escritos desde la
+// ultima vez que esa copia se publico, y no el bloque entero de estelas.
+class FramePipeline {
+public:
+    // PASO DE SIMULACION: AVANZA EL ESTADO VIVO UN FRAME, ANOTA SUS FASES Y
+    // DEVUELVE CUANTOS PASOS DE SIMULACION CORRIO
+    using Step = std::function<int(PhaseTimes&)>;
+
+    explicit FramePipeline(const ParticleSystem& live);
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline& operator=(const FramePipeline&) = delete;
+    ~FramePipeline();
+
+    // FUNCION PARA EMPEZAR A SIMULAR EN EL HILO DEL PIPELINE
+    void start(ParticleSystem& live, Step step);
+
+    // FUNCION PARA ESPERAR EL SIGUIENTE FRAME (nullptr SI SE DETUVO)
+    const ParticleSystem* acquire(PhaseTimes& simTimes);
+
+    // FUNCION PARA DETENER LA SIMULACION Y ESPERAR AL HILO
+    void stop();
+
+private:
+    // COPIA DEL ESTADO Y EL PASO EN QUE SE PUBLICO
+    struct Copy {
+        ParticleSystem state; // LO QUE SE DIBUJA
+        uint64_t steps = 0; // PASOS SIMULADOS CUANDO SE PUBLICO
+        bool published = false; // YA SE PUBLICO ALGUNA VEZ
+    };
+
+    // CICLO DEL HILO DE SIMULACION
+    void run(ParticleSystem& live, Step step);
+
+    // FUNCION PARA COPIAR A back LO QUE CAMBIO DESDE SU ULTIMA PUBLICACION
+    void publish(const ParticleSystem& live, uint64_t steps);
+
+    Copy back, ready, front; // COPIAS DEL ESTADO
+    PhaseTimes readyTimes{}; // FASES DEL FRAME PUBLICADO
+    bool hasReady = false; // HAY UN FRAME PUBLICADO SIN DIBUJAR
+    bool stopping = false; // SE PIDIO DETENER LA SIMULACION
+    std::mutex mutex; // PROTEGE ready, readyTimes, hasReady Y stopping
+    std::condition_variable changed; // AVISA CUANDO CAMBIA hasReady O stopping
+    std::thread worker; // HILO DE SIMULACION
+};
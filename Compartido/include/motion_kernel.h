@@ -0,0 +1,51 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <cstddef> // Include cstddef header
+#include "particle_system.h" // Include particle system header
+
+// Kernel de movimiento: avanza las particulas que orbitan (angulo, posicion,
+// absorcion y reduccion de radio) y las que se mueven libremente (posicion y
+// rebote) sin ramas por particula. Hay una version AVX2 (8 particulas por
+// iteracion), una SSE4.1 (4 por iteracion) y una escalar; la mejor que soporte
+// el procesador se escoge una sola vez al ejecutar. El seno y coseno de la
+// orbita se calculan segun OrbitMotion; las tres versiones dan el mismo
+// resultado bit a bit para cada modo.
+
+// FORMA DE CALCULAR LA POSICION EN LA ORBITA
+enum OrbitMotion {
+    ORBIT_MOTION_LIBM = 0, // std::cos / std::sin DE LA BIBLIOTECA ESTANDAR
+    ORBIT_MOTION_POLY = 1, // POLINOMIO EN FLOAT VECTORIZADO (fast_math.h)
+    ORBIT_MOTION_ROTATION = 2 // ROTAR EL PAR (COS, SIN) GUARDADO EN CADA PARTICULA
+};
+
+// CENTROS DE LAS ORBITAS (x[k], y[k] ES EL CENTRO DE LA ORBITA k), DE SOLO LECTURA
+struct OrbitCenters {
+    const float* x; // COORDENADAS X
+    const float* y; // COORDENADAS Y
+};
+
+// PARAMETROS DEL MOVIMIENTO
+struct MotionParams {
+    float orbitSpeed; // VELOCIDAD DE LA ORBITA
+    float absorptionRadius; // RADIO DE ABSORCION
+    float radiusDecay; // REDUCCION DEL RADIO POR FRAME
+    float width, height; // TAMANO DE LA PANTALLA
+    int mode; // OrbitMotion
+    float cosStep, sinStep; // ROTACION DE UN FRAME (ORBIT_MOTION_ROTATION)
+};
+
+// MOVER LAS PARTICULAS [begin, end). LAS QUE LLEGAN AL RADIO DE ABSORCION
+// QUEDAN MARCADAS COMO PARTICLE_DEAD; LAS PARTICLE_ESCAPING NO SE MUEVEN
+void integrateMotion(ParticleSystem& ps, size_t begin, size_t end, const OrbitCenters& centers,
+                     const MotionParams& params);
+
+// NOMBRE DEL KERNEL ESCOGIDO ("avx2", "sse4.1" O "scalar")
+const char* motionKernelName();
@@ -0,0 +1,31 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include "bench.h" // Include bench header
+
+// Opciones del programa. Cada parametro global de settings.h se puede dar en
+// la linea de comandos (--particles 5000) o en un archivo de configuracion
+// (--config archivo) con una linea "clave = valor" por parametro, usando el
+// mismo nombre sin los guiones. Las lineas vacias y las que empiezan con #
+// se ignoran. Primero se aplica el archivo y despues la linea de comandos,
+// asi que los flags ganan. Todo valor se valida antes de usarse.
+
+// RESULTADO DE LEER LAS OPCIONES
+enum OptionsResult {
+    OPTIONS_OK = 0, // SEGUIR CON EL PROGRAMA
+    OPTIONS_HELP, // SE MOSTRO LA AYUDA, SALIR SIN ERROR
+    OPTIONS_ERROR // OPCION INVALIDA (EL MENSAJE YA SE MOSTRO), SALIR CON ERROR
+};
+
+// FUNCION PARA LEER LAS OPCIONES Y LLENAR LOS PARAMETROS GLOBALES
+OptionsResult parseOptions(int argc, char* argv[], BenchOptions& bench);
+
+// FUNCION PARA MOSTRAR LA AYUDA
+void printUsage(const char* program);
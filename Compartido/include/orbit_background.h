@@ -0,0 +1,47 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <SDL2/SDL.h> // Include SDL2 header
+#include <vector> // Include vector header
+#include "rasterizer.h" // Include software rasterizer header
+#include "simulation.h" // Include simulation header
+
+// Fondo del frame: pantalla negra con los anillos de las orbitas. Las orbitas
+// no se mueven despues de crearse, asi que el fondo se rasteriza una sola vez
+// en memoria y se sube a una textura estatica. Cada frame empieza copiando el
+// fondo (memcpy en el rasterizador por software, un SDL_RenderCopy con SDL) en
+// lugar de limpiar la pantalla y volver a dibujar las orbitas. Solo hay que
+// llamar a build otra vez si cambian las orbitas o el tamano de la pantalla.
+class OrbitBackground {
+public:
+    // FUNCION PARA RASTERIZAR EL FONDO Y CREAR SU TEXTURA
+    void build(SDL_Renderer* renderer, const OrbitGeometry& orbits, int width, int height);
+
+    // FUNCION PARA VOLVER A SUBIR LA TEXTURA (SDL_RENDER_DEVICE_RESET LA INVALIDA)
+    void reloadTexture(SDL_Renderer* renderer);
+
+    // FUNCION PARA COPIAR EL FONDO AL FRAMEBUFFER DEL RASTERIZADOR POR SOFTWARE
+    void copyTo(const FrameBuffer& fb) const;
+
+    // FUNCION PARA COPIAR SOLO LAS FILAS [first, last) DEL FONDO
+    void copyRows(const FrameBuffer& fb, int first, int last) const;
+
+    // FUNCION PARA DIBUJAR EL FONDO CON EL RENDERIZADOR DE SDL
+    void draw(SDL_Renderer* renderer) const;
+
+    // FUNCION PARA DESTRUIR LA TEXTURA (ANTES DE DESTRUIR EL RENDERIZADOR)
+    void destroy();
+
+private:
+    std::vector<Uint32> pixels; // FONDO RASTERIZADO (ARGB8888, SIN RELLENO ENTRE FILAS)
+    std::vector<SDL_Point> ringPoints; // PUNTOS DE LOS ANILLOS, POR SI NO HAY TEXTURA
+    SDL_Texture* texture = nullptr; // TEXTURA ESTATICA CON EL FONDO
+    int width = 0, height = 0; // TAMANO EN PIXELES
+};
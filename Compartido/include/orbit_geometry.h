@@ -0,0 +1,32 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <vector> // Include vector header
+#include <cstddef> // Include cstddef header
+#include <cstdint> // Include cstdint header
+
+// Geometria de las orbitas: centros y radios en arreglos de floats separados
+// y contiguos. Se arma una sola vez con makeOrbitLayout y despues solo se lee,
+// por eso se pasa const a los kernels. Los contadores de absorcion, que si
+// cambian en cada frame, viven aparte en AbsorptionStats; asi escribirlos
+// nunca invalida las lineas de cache de la geometria, y el kernel SIMD lee
+// los centros directamente con el indice de orbita.
+struct OrbitGeometry {
+    std::vector<float> x; // COORDENADAS X DE LOS CENTROS
+    std::vector<float> y; // COORDENADAS Y DE LOS CENTROS
+    std::vector<float> radius; // RADIOS DE LOS ANILLOS
+
+    size_t size() const { return x.size(); }
+    bool empty() const { return x.empty(); }
+};
+
+// FUNCION PARA CREAR count ORBITAS REPARTIDAS A LO ANCHO DE LA PANTALLA,
+// ALTERNANDO ENTRE EL CUARTO DE ARRIBA Y EL DE ABAJO
+OrbitGeometry makeOrbitLayout(int count, int width, int height, uint64_t seed);
@@ -0,0 +1,87 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <vector> // Include vector header
+#include <cmath> // Include cmath header
+#include <algorithm> // Include algorithm header
+#include "orbit_geometry.h" // Include orbit geometry header
+
+// Cuadricula uniforme sobre la pantalla para buscar orbitas cercanas. Las
+// celdas miden al menos el radio de captura, asi que toda orbita a menos de
+// ese radio de una particula esta en la celda de la particula o en una de sus
+// 8 vecinas. Se construye una sola vez porque las orbitas no se mueven.
+struct OrbitGrid {
+    float cellSize = 1.0f; // TAMANO DE CADA CELDA
+    float invCellSize = 1.0f; // INVERSO DEL TAMANO DE CELDA
+    int cols = 1, rows = 1; // CANTIDAD DE CELDAS
+    std::vector<int> cellStart; // INICIO DE CADA CELDA EN orbitIds (cols * rows + 1)
+    std::vector<int> orbitIds; // INDICES DE ORBITA ORDENADOS POR CELDA
+
+    static constexpr int MAX_CELLS_PER_AXIS = 1024; // LIMITE DE CELDAS POR EJE
+
+    // CONSTRUIR LA CUADRICULA A PARTIR DE LOS CENTROS DE LAS ORBITAS
+    void build(const OrbitGeometry& orbits, int width, int height, float radius) {
+        // LAS CELDAS NUNCA SON MAS PEQUENAS QUE EL RADIO, PERO SE AGRANDAN SI
+        // EL RADIO ES TAN PEQUENO QUE LA CUADRICULA SERIA ENORME
+        float extent = static_cast<float>(std::max(width, height)); // LADO MAS LARGO
+        cellSize = std::max({radius, extent / MAX_CELLS_PER_AXIS, 1.0f});
+        invCellSize = 1.0f / cellSize;
+        cols = std::max(1, static_cast<int>(std::ceil(width * invCellSize)));
+        rows = std::max(1, static_cast<int>(std::ceil(height * invCellSize)));
+
+        // CONTAR ORBITAS POR CELDA
+        cellStart.assign(static_cast<size_t>(cols) * rows + 1, 0);
+        for (size_t j = 0; j < orbits.size(); ++j) {
+            cellStart[cellOf(orbits.x[j], orbits.y[j]) + 1]++;
+        }
+        // SUMA PREFIJA PARA OBTENER EL INICIO DE CADA CELDA
+        for (size_t c = 1; c < cellStart.size(); ++c) {
+            cellStart[c] += cellStart[c - 1];
+        }
+        // LLENAR INDICES EN ORDEN CRECIENTE DENTRO DE CADA CELDA
+        orbitIds.resize(orbits.size());
+        std::vector<int> fill(cellStart.begin(), cellStart.end() - 1); // POSICION DE ESCRITURA
+        for (size_t j = 0; j < orbits.size(); ++j) {
+            orbitIds[fill[cellOf(orbits.x[j], orbits.y[j])]++] = static_cast<int>(j);
+        }
+    }
+
+    // COLUMNA DE UNA COORDENADA, LIMITADA A LA CUADRICULA
+    int colOf(float x) const {
+        return std::clamp(static_cast<int>(std::floor(x * invCellSize)), 0, cols - 1);
+    }
+
+    // FILA DE UNA COORDENADA, LIMITADA A LA CUADRICULA
+    int rowOf(float y) const {
+        return std::clamp(static_cast<int>(std::floor(y * invCellSize)), 0, rows - 1);
+    }
+
+    // INDICE DE LA CELDA QUE CONTIENE UN PUNTO
+    int cellOf(float x, float y) const {
+        return rowOf(y) * cols + colOf(x);
+    }
+
+    // LLAMAR f(j) PARA CADA ORBITA j EN LA VECINDAD 3x3 DEL PUNTO (x, y).
+    // LAS PARTICULAS FUERA DE LA PANTALLA USAN LA CELDA DEL BORDE MAS CERCANA,
+    // QUE SIGUE CUBRIENDO TODAS LAS ORBITAS DENTRO DEL RADIO.
+    template <typename F>
+    void forEachNeighbour(float x, float y, F&& f) const {
+        int col = colOf(x), row = rowOf(y); // CELDA DEL PUNTO
+        int r0 = std::max(row - 1, 0), r1 = std::min(row + 1, rows - 1);
+        int c0 = std::max(col - 1, 0), c1 = std::min(col + 1, cols - 1);
+        for (int r = r0; r <= r1; ++r) {
+            // LAS CELDAS DE UNA FILA SON CONTIGUAS EN orbitIds
+            int begin = cellStart[r * cols + c0], end = cellStart[r * cols + c1 + 1];
+            for (int k = begin; k < end; ++k) {
+                f(orbitIds[k]);
+            }
+        }
+    }
+};
@@ -0,0 +1,175 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <SDL2/SDL.h> // Include SDL2 header
+#include <vector> // Include vector header
+#include <cstddef> // Include cstddef header
+#include <cstdint> // Include cstdint header
+#include <algorithm> // Include algorithm header
+#include <cmath> // Include cmath header
+
+// ESTADOS POSIBLES DE UNA PARTICULA
+enum ParticleState : uint8_t {
+    PARTICLE_ROAMING = 0, // SE MUEVE LIBREMENTE
+    PARTICLE_ORBITING = 1, // ESTA EN ORBITA
+    PARTICLE_DEAD = 2, // FUE ABSORBIDA, PENDIENTE DE ELIMINAR
+    PARTICLE_ESCAPING = 3, // ESCAPO DE SU ORBITA EN ESTE FRAME, NO SE MUEVE
+    PARTICLE_FREE = 4 // POSICION LIBRE DEL POOL, NO SE ACTUALIZA NI SE DIBUJA
+};
+
+// IDENTIFICADOR DE LA PARTICULA QUE OCUPA LA POSICION slot POR generation-ESIMA
+// VEZ. ES LA LLAVE DEL GENERADOR ALEATORIO, ASI QUE NO DEPENDE DE LOS HILOS.
+inline uint64_t particleId(size_t slot, uint32_t generation) {
+    return (static_cast<uint64_t>(generation) << 32) | static_cast<uint32_t>(slot);
+}
+
+// Estructura de arreglos para almacenar todas las particulas. Cada campo vive
+// en su propio arreglo contiguo para que el ciclo de actualizacion recorra la
+// memoria de forma secuencial y el compilador lo pueda vectorizar.
+//
+// Las estelas viven en un solo bloque de memoria reservado al inicio, con
+// trailLength espacios por particula usados como buffer circular: agregar un
+// punto es O(1) y nunca reserva memoria.
+//
+// Es un pool de capacidad fija: una particula nunca cambia de posicion. Cuando
+// una es absorbida se reinicia en su mismo lugar (updateParticles), asi que con
+// la poblacion constante no se borra, agrega ni mueve nada. Las posiciones que
+// se liberan con release quedan marcadas en la mascara alive y en freeSlots, y
+// se vuelven a usar antes de crecer.
+struct ParticleSystem {
+    std::vector<uint64_t> id; // IDENTIFICADOR UNICO (LLAVE DEL GENERADOR ALEATORIO)
+    std::vector<float> x, y; // COORDENADAS
+    std::vector<float> dx, dy; // VELOCIDADES
+    std::vector<float> angle; // ANGULO
+    std::vector<float> orbitCos, orbitSin; // COSENO Y SENO DEL ANGULO (ROTACION INCREMENTAL)
+    std::vector<float> orbitRadius; // RADIO DE ORBITA
+    std::vector<int> orbitIndex; // INDICE DE ORBITA
+    std::vector<uint8_t> state; // ESTADO (ParticleState)
+    std::vector<SDL_Color> color; // COLOR
+    std::vector<int> trailHead; // POSICION DEL PUNTO MAS NUEVO EN LA ESTELA
+    std::vector<int> trailCount; // CANTIDAD DE PUNTOS EN LA ESTELA
+    std::vector<uint32_t> generation; // VECES QUE SE HA REUSADO CADA POSICION
+
+    size_t capacity; // CANTIDAD MAXIMA DE PARTICULAS
+    int trailLength; // LONGITUD DE LA ESTELA
+    std::vector<SDL_Point> trailPoints; // PUNTOS DE TODAS LAS ESTELAS
+    std::vector<uint64_t> alive; // MASCARA DE POSICIONES OCUPADAS (UN BIT POR POSICION)
+    std::vector<uint32_t> freeSlots; // POSICIONES LIBERADAS, SE REUSAN PRIMERO
+    size_t aliveCount = 0; // CANTIDAD DE PARTICULAS VIVAS
+
+    // CONSTRUCTOR: RESERVA MEMORIA PARA capacity PARTICULAS Y SUS ESTELAS
+    ParticleSystem(size_t capacity, int trailLength)
+        : capacity(capacity), trailLength(trailLength > 0 ? trailLength : 1) {
+        id.reserve(capacity);
+        x.reserve(capacity); y.reserve(capacity);
+        dx.reserve(capacity); dy.reserve(capacity);
+        angle.reserve(capacity);
+        orbitCos.reserve(capacity); orbitSin.reserve(capacity);
+        orbitRadius.reserve(capacity);
+        orbitIndex.reserve(capacity);
+        state.reserve(capacity);
+        color.reserve(capacity);
+        trailHead.reserve(capacity);
+        trailCount.reserve(capacity);
+        generation.reserve(capacity);
+        trailPoints.resize(capacity * this->trailLength);
+        alive.resize((capacity + 63) / 64);
+        freeSlots.reserve(capacity);
+    }
+
+    // CANTIDAD DE POSICIONES USADAS (VIVAS Y LIBRES); LOS CICLOS RECORREN [0, size())
+    size_t size() const { return x.size(); }
+
+    // SABER SI LA POSICION i TIENE UNA PARTICULA VIVA
+    bool isAlive(size_t i) const { return (alive[i / 64] >> (i % 64)) & 1; }
+
+    // MARCAR LA POSICION i COMO OCUPADA (NO ES SEGURO DESDE VARIOS HILOS)
+    void markAlive(size_t i) {
+        SDL_assert(!isAlive(i));
+        alive[i / 64] |= uint64_t(1) << (i % 64);
+        aliveCount++;
+    }
+
+    // AGREGAR UN PUNTO A LA ESTELA DE LA PARTICULA i (O(1))
+    void pushTrail(size_t i, SDL_Point point) {
+        int head = trailHead[i] + 1; // SIGUIENTE POSICION DEL BUFFER
+        if (head == trailLength) head = 0;
+        trailHead[i] = head;
+        trailPoints[i * trailLength + head] = point;
+        if (trailCount[i] < trailLength) trailCount[i]++;
+    }
+
+    // OBTENER EL PUNTO t DE LA ESTELA DE LA PARTICULA i (0 ES EL MAS NUEVO)
+    const SDL_Point& trailPoint(size_t i, int t) const {
+        int index = trailHead[i] - t; // RECORRER EL BUFFER HACIA ATRAS
+        if (index < 0) index += trailLength;
+        return trailPoints[i * trailLength + index];
+    }
+
+    // OBTENER EL PUNTO t DE LA ESTELA PARA DIBUJARLO. CON blend < 1 EL MAS NUEVO
+    // SE INTERPOLA ENTRE LOS DOS ULTIMOS PASOS (PASO DE TIEMPO FIJO)
+    SDL_Point renderPoint(size_t i, int t, float blend) const {
+        const SDL_Point& point = trailPoint(i, t); // PUNTO DEL ULTIMO PASO
+        if (t != 0 || blend >= 1 || trailCount[i] < 2) return point;
+        const SDL_Point& previous = trailPoint(i, 1); // PUNTO DEL PASO ANTERIOR
+        return SDL_Point{previous.x + static_cast<int>(std::lround((point.x - previous.x) * blend)),
+                         previous.y + static_cast<int>(std::lround((point.y - previous.y) * blend))};
+    }
+
+    // AGREGAR count POSICIONES LIBRES AL FINAL (SIN RESERVAR MEMORIA, YA ESTA
+    // RESERVADA) Y DEVOLVER LA PRIMERA. SE LLENAN DESPUES CON init, CADA
+    // POSICION DESDE CUALQUIER HILO, Y SE MARCAN CON markAlive.
+    size_t grow(size_t count) {
+        size_t first = size(); // PRIMERA POSICION NUEVA
+        SDL_assert(first + count <= capacity);
+        size_t n = first + count; // NUEVA CANTIDAD DE PARTICULAS
+        id.resize(n);
+        x.resize(n); y.resize(n);
+        dx.resize(n); dy.resize(n);
+        angle.resize(n);
+        orbitCos.resize(n); orbitSin.resize(n);
+        orbitRadius.resize(n);
+        orbitIndex.resize(n);
+        state.resize(n);
+        color.resize(n);
+        trailHead.resize(n);
+        trailCount.resize(n);
+        generation.resize(n);
+        std::fill(state.begin() + first, state.end(), PARTICLE_FREE);
+        return first;
+    }
+
+    // INICIALIZAR LA POSICION i CON UNA PARTICULA NUEVA QUE SE MUEVE LIBREMENTE.
+    // LA ESTELA ANTERIOR SE DESCARTA SIN TOCAR SU MEMORIA.
+    void init(size_t i, uint64_t pid, float px, float py, float pdx, float pdy, SDL_Color c) {
+        id[i] = pid;
+        x[i] = px; y[i] = py;
+        dx[i] = pdx; dy[i] = pdy;
+        angle[i] = 0;
+        orbitCos[i] = 1; orbitSin[i] = 0;
+        orbitRadius[i] = 0;
+        orbitIndex[i] = -1;
+        state[i] = PARTICLE_ROAMING;
+        color[i] = c;
+        trailHead[i] = -1;
+        trailCount[i] = 0;
+    }
+
+    // LIBERAR LA POSICION i: SE DEJA DE ACTUALIZAR Y DIBUJAR Y SE REUSA EN EL
+    // SIGUIENTE spawnParticles (NO ES SEGURO DESDE VARIOS HILOS)
+    void release(size_t i) {
+        SDL_assert(isAlive(i));
+        alive[i / 64] &= ~(uint64_t(1) << (i % 64));
+        aliveCount--;
+        state[i] = PARTICLE_FREE;
+        trailCount[i] = 0;
+        freeSlots.push_back(static_cast<uint32_t>(i));
+    }
+};
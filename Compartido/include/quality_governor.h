@@ -0,0 +1,64 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <string> // Include string header
+
+// Control de calidad adaptativo (--frame-budget). Con el tiempo medido de
+// cada frame ajusta tres niveles para mantenerse dentro del presupuesto:
+// las particulas vivas, la longitud de estela que se dibuja y los hilos.
+// Decide una vez por ventana de frames con el promedio de la ventana:
+//  - si se pasa del presupuesto: primero sube hilos, despues acorta la
+//    estela y al final quita particulas;
+//  - si le sobra mas de un margen: devuelve particulas, despues estela y al
+//    final suelta hilos que ya no necesita.
+// Entre el presupuesto y el margen no cambia nada (histeresis), y despues de
+// cada cambio empieza una ventana nueva para medir su efecto.
+
+// NIVELES DE CALIDAD
+struct QualityLevels {
+    int particles; // PARTICULAS VIVAS
+    int trailLength; // PUNTOS DE ESTELA QUE SE DIBUJAN
+    int threads; // TRABAJADORES QUE CORREN A LA VEZ
+};
+
+class QualityGovernor {
+public:
+    // budgetMs: PRESUPUESTO DEL FRAME; best Y worst: LIMITES DE CADA NIVEL
+    QualityGovernor(double budgetMs, QualityLevels best, QualityLevels worst);
+
+    // FUNCION PARA REGISTRAR LA DURACION DE UN FRAME; DEVUELVE true SI
+    // CAMBIO ALGUN NIVEL (levels() TIENE LOS NUEVOS)
+    bool addFrame(double frameMs);
+
+    // NIVELES ACTUALES
+    const QualityLevels& levels() const { return current; }
+
+    // PROMEDIO DE LA ULTIMA VENTANA (ms)
+    double averageMs() const { return lastAverage; }
+
+    // DESCRIPCION DE LA ULTIMA DECISION ("hold" SI NO HA CAMBIADO NADA)
+    const std::string& lastDecision() const { return decision; }
+
+private:
+    static constexpr int WINDOW_FRAMES = 30; // FRAMES POR DECISION
+    static constexpr double HEADROOM = 0.75; // SOLO SUBE LA CALIDAD DEBAJO DE ESTA FRACCION DEL PRESUPUESTO
+
+    // FUNCIONES PARA BAJAR O SUBIR UN PASO DE CALIDAD
+    bool degrade();
+    bool improve();
+
+    double budget; // PRESUPUESTO DEL FRAME (ms)
+    QualityLevels best, worst; // LIMITES DE LOS NIVELES
+    QualityLevels current; // NIVELES ACTUALES
+    double windowSum = 0; // SUMA DE LA VENTANA ACTUAL (ms)
+    int windowFrames = 0; // FRAMES DE LA VENTANA ACTUAL
+    double lastAverage = 0; // PROMEDIO DE LA ULTIMA VENTANA (ms)
+    std::string decision = "hold"; // ULTIMA DECISION
+};
@@ -0,0 +1,52 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <cstdint> // Include cstdint header
+
+// Generador aleatorio basado en contador (estilo SplitMix64). No guarda estado:
+// cada numero se calcula a partir de (semilla, identificador, frame, flujo), asi
+// que cada particula obtiene los mismos valores sin importar que hilo la
+// actualiza ni cuantos hilos hay, y ningun hilo comparte un generador.
+
+// FLUJOS INDEPENDIENTES DE NUMEROS ALEATORIOS
+enum RandomStream : uint32_t {
+    RNG_ORBIT_RADIUS = 0, // RADIO DE UNA ORBITA
+    RNG_SPAWN_X, // COORDENADA X AL CREAR
+    RNG_SPAWN_Y, // COORDENADA Y AL CREAR
+    RNG_SPAWN_DX, // VELOCIDAD EN X AL CREAR
+    RNG_SPAWN_DY, // VELOCIDAD EN Y AL CREAR
+    RNG_SPAWN_COLOR, // COLOR AL CREAR
+    RNG_ESCAPE, // PROBABILIDAD DE ESCAPE
+    RNG_ESCAPE_DX, // VELOCIDAD EN X AL ESCAPAR
+    RNG_ESCAPE_DY, // VELOCIDAD EN Y AL ESCAPAR
+    RNG_CAPTURE_COLOR, // COLOR AL SER CAPTURADA
+    RNG_CAPTURE // PROBABILIDAD DE CAPTURA (+ INDICE DE ORBITA)
+};
+
+// FUNCION DE MEZCLA DE SPLITMIX64
+inline uint64_t splitMix64(uint64_t z) {
+    z += 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// FUNCION PARA OBTENER 64 BITS ALEATORIOS A PARTIR DE UN CONTADOR
+inline uint64_t counterRandom(uint64_t seed, uint64_t id, uint64_t frame, uint32_t stream) {
+    uint64_t h = splitMix64(seed ^ (static_cast<uint64_t>(stream) << 32)); // LLAVE DEL FLUJO
+    h = splitMix64(h ^ id); // MEZCLAR IDENTIFICADOR
+    return splitMix64(h ^ frame); // MEZCLAR FRAME
+}
+
+// FUNCION PARA OBTENER UN NUMERO ALEATORIO UNIFORME EN [0, 1)
+inline float counterUniform(uint64_t seed, uint64_t id, uint64_t frame, uint32_t stream) {
+    // USAR LOS 24 BITS ALTOS PARA LLENAR LA MANTISA DE UN FLOAT
+    return static_cast<float>(counterRandom(seed, id, frame, stream) >> 40) * (1.0f / 16777216.0f);
+}
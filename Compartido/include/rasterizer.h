@@ -0,0 +1,84 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <SDL2/SDL.h> // Include SDL2 header
+#include <vector> // Include vector header
+#include <cstdint> // Include cstdint header
+#include "particle_system.h" // Include particle system header
+#include "simulation.h" // Include simulation header
+
+// Rasterizador por software: dibuja orbitas y estelas directamente en un
+// framebuffer ARGB8888 en memoria (normalmente una textura SDL_TEXTUREACCESS_
+// STREAMING bloqueada con SDL_LockTexture), sin llamar a SDL por cada punto.
+// Asi todo el frame se sube con un solo SDL_RenderCopy y el dibujo puede
+// correr en varios hilos, cosa que el renderizador de SDL no permite.
+
+// VISTA DE UN FRAMEBUFFER ARGB8888
+struct FrameBuffer {
+    Uint32* pixels; // PRIMER PIXEL
+    int width, height; // TAMANO EN PIXELES
+    int pitch; // PIXELES POR FILA (PUEDE SER MAYOR QUE width)
+};
+
+// FUNCION PARA EMPAQUETAR UN COLOR EN ARGB8888
+inline Uint32 packColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255) {
+    return (static_cast<Uint32>(a) << 24) | (static_cast<Uint32>(r) << 16) | (static_cast<Uint32>(g) << 8) | b;
+}
+
+// FUNCION PARA LLENAR TODO EL FRAMEBUFFER CON UN COLOR
+void clearFrame(const FrameBuffer& fb, Uint32 color);
+
+// FUNCION PARA CALCULAR LOS 360 PUNTOS DEL ANILLO DE CADA ORBITA
+void buildOrbitRings(const OrbitGeometry& orbits, std::vector<SDL_Point>& points);
+
+// FUNCION PARA DIBUJAR LAS ORBITAS (360 PUNTOS GRISES CADA UNA)
+void rasterizeOrbits(const FrameBuffer& fb, const OrbitGeometry& orbits);
+
+// Dibuja las estelas con mezcla alfa. El framebuffer se divide en bandas de
+// filas: primero cada hilo clasifica los puntos de su rango contiguo de
+// particulas por banda, y despues cada banda la mezcla un solo hilo
+// recorriendo los puntos en el orden original de las particulas. El resultado
+// no depende de la cantidad de hilos y ningun pixel se escribe desde dos
+// hilos a la vez. Las dos pasadas tambien se pueden correr por partes como
+// tareas de un grafo (begin, binRange y blendBand).
+class TrailRasterizer {
+public:
+    // FUNCION PARA DIBUJAR LAS ESTELAS DE TODAS LAS PARTICULAS (blend: VER
+    // ParticleSystem::renderPoint)
+    void draw(const FrameBuffer& fb, const ParticleSystem& ps, int trailLength, float blend = 1.0f);
+
+    // FUNCION PARA PREPARAR UN DIBUJO POR PARTES CON ranges RANGOS DE PARTICULAS
+    void begin(const FrameBuffer& fb, int trailLength, int ranges, float blend = 1.0f);
+
+    // FUNCION PARA CLASIFICAR POR BANDA LAS PARTICULAS [first, last) DEL RANGO range
+    void binRange(const ParticleSystem& ps, size_t first, size_t last, int range);
+
+    // FUNCION PARA MEZCLAR UNA BANDA (YA SE CLASIFICARON TODOS LOS RANGOS)
+    void blendBand(int band);
+
+    // FUNCIONES PARA OBTENER LAS BANDAS DEL DIBUJO ACTUAL
+    int bandCount() const { return bands; }
+    int bandHeight() const { return rowsPerBand; }
+
+private:
+    // PUNTO YA CLASIFICADO: PIXEL DESTINO Y COLOR CON ALFA
+    struct Fragment {
+        Uint32 offset; // POSICION DEL PIXEL EN EL FRAMEBUFFER
+        Uint32 color; // COLOR ARGB8888
+    };
+
+    std::vector<std::vector<Fragment>> bins; // FRAGMENTOS POR (RANGO, BANDA)
+    FrameBuffer target{}; // FRAMEBUFFER DEL DIBUJO ACTUAL
+    int trail = 1; // LONGITUD DE LA ESTELA
+    float pointBlend = 1.0f; // INTERPOLACION DEL PUNTO MAS NUEVO
+    int rangeCount = 1; // RANGOS DE PARTICULAS
+    int rowsPerBand = 1; // FILAS POR BANDA
+    int bands = 0; // CANTIDAD DE BANDAS
+};
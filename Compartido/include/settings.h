@@ -0,0 +1,62 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <cstdint> // Include cstdint header
+#include <string> // Include string header
+
+// Parametros globales de la simulacion, compartidos por ambas versiones.
+// Se definen en settings.cpp y parseOptions (options.h) los llena antes de
+// crear la simulacion.
+
+// FORMAS DE DIBUJAR UN FRAME
+enum RenderMode {
+    RENDER_SDL = 0, // UNA LLAMADA A SDL_RenderDrawPoint POR PUNTO
+    RENDER_SOFTWARE = 1, // RASTERIZADOR POR SOFTWARE EN UNA TEXTURA STREAMING
+    RENDER_POINTS = 2, // UN SDL_RenderDrawPoints POR GRUPO DE COLOR Y ALFA
+    RENDER_GEOMETRY = 3 // UN SOLO SDL_RenderGeometry CON COLOR POR VERTICE
+};
+
+// REPARTO DE LOS BLOQUES DEL CICLO DE ACTUALIZACION ENTRE LOS HILOS
+enum UpdateSchedule {
+    SCHEDULE_STATIC = 0, // PEDAZOS FIJOS ASIGNADOS DE ANTEMANO
+    SCHEDULE_DYNAMIC = 1, // CADA HILO TOMA EL SIGUIENTE PEDAZO AL TERMINAR
+    SCHEDULE_GUIDED = 2 // COMO DYNAMIC, CON PEDAZOS QUE SE ACHICAN
+};
+
+extern int SCREEN_WIDTH; //  ANCHO DE LA PANTALLA
+extern int SCREEN_HEIGHT;  // ALTO DE LA PANTALLA
+extern int INITIAL_PARTICLES; // CANTIDAD DE PARTICULAS INICIALES
+extern int TRAIL_LENGTH; // LONGITUD DE LA ESTELA
+extern int NUM_ORBITS; // CANTIDAD DE ORBITAS
+extern float ORBIT_SPEED; // VELOCIDAD DE LA ORBITA
+extern float ROAM_SPEED; // VELOCIDAD DE MOVIMIENTO
+extern float CAPTURE_RADIUS; // RADIO DE CAPTURA
+extern float ABSORPTION_RADIUS; // RADIO DE ABSORCION
+extern float ESCAPE_PROBABILITY; // PROBABILIDAD DE ESCAPE
+extern float CAPTURE_PROBABILITY; // PROBABILIDAD DE CAPTURA
+extern uint64_t SEED; // SEMILLA DEL GENERADOR ALEATORIO
+extern int ORBIT_MOTION; // CALCULO DEL SENO Y COSENO DE LA ORBITA (OrbitMotion)
+extern int RENDER_MODE; // FORMA DE DIBUJAR (RenderMode)
+extern int BACKEND; // BACKEND DE EJECUCION (ExecutionBackend)
+extern int NUM_THREADS; // HILOS DEL BACKEND (0: LOS QUE DECIDA EL SISTEMA)
+extern bool PIPELINE; // SIMULAR EL SIGUIENTE FRAME MIENTRAS SE DIBUJA EL ACTUAL
+extern int UPDATE_SCHEDULE; // REPARTO DEL CICLO DE ACTUALIZACION (UpdateSchedule)
+extern int SCHEDULE_CHUNK; // BLOQUES POR PEDAZO (0: EL VALOR POR DEFECTO DE OPENMP)
+extern float SIM_RATE; // PASOS DE SIMULACION POR SEGUNDO (0: UN PASO POR FRAME)
+extern int MAX_SUBSTEPS; // PASOS MAXIMOS POR FRAME, LOS DEMAS SE DESCARTAN
+extern float FRAME_BUDGET; // PRESUPUESTO DEL FRAME EN ms PARA EL CONTROL DE CALIDAD (0: APAGADO)
+extern std::string TRACE_FILE; // ARCHIVO DE LA TRAZA (VACIO: SIN TRAZA)
+
+// FUNCION PARA OBTENER EL NOMBRE DE UN REPARTO
+const char* scheduleName(int schedule);
+
+// FUNCION PARA APLICAR --threads Y --schedule AL HILO QUE LLAMA. SON VARIABLES
+// DE CADA HILO EN OPENMP: LOS HILOS CREADOS CON std::thread NO LAS HEREDAN
+void applyThreadSettings();
@@ -0,0 +1,41 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <SDL2/SDL.h> // Include SDL2 header
+#include <vector> // Include vector header
+#include <cstddef> // Include cstddef header
+#include <cstdint> // Include cstdint header
+#include "particle_system.h" // Include particle system header
+#include "orbit_geometry.h" // Include orbit geometry header
+#include "orbit_grid.h" // Include orbit grid header
+
+// CANTIDAD DE PARTICULAS QUE SE ACTUALIZAN JUNTAS (MULTIPLO DEL ANCHO SIMD)
+constexpr size_t UPDATE_BLOCK_SIZE = 1024;
+
+// FUNCION PARA OBTENER UN COLOR ALEATORIO
+SDL_Color getRandomColor(uint64_t id, uint64_t frame, uint32_t stream);
+
+// FUNCION PARA INICIALIZAR LA POSICION i DEL POOL CON UNA PARTICULA NUEVA
+void spawnAt(ParticleSystem& ps, size_t i);
+
+// FUNCION PARA AGREGAR PARTICULAS HASTA TENER target VIVAS (SIN PASAR LA
+// CAPACIDAD), REUSANDO POSICIONES LIBRES Y EN PARALELO; DEVUELVE CUANTAS SE
+// AGREGARON
+size_t spawnParticles(ParticleSystem& ps, size_t target);
+
+// FUNCION PARA LIBERAR PARTICULAS, DE LA ULTIMA POSICION HACIA ATRAS, HASTA
+// TENER target VIVAS; DEVUELVE CUANTAS SE LIBERARON
+size_t releaseParticles(ParticleSystem& ps, size_t target);
+
+// FUNCION PARA ACTUALIZAR LAS PARTICULAS [begin, end). LAS QUE SON ABSORBIDAS
+// SE REINICIAN EN SU MISMA POSICION Y SE CUENTAN EN absorbed[orbita] (LOS
+// CONTADORES DEL HILO QUE LLAMA); DEVUELVE CUANTAS FUERON ABSORBIDAS
+size_t updateParticles(ParticleSystem& ps, size_t begin, size_t end, const OrbitGeometry& orbits,
+                       const OrbitGrid& grid, uint64_t frame, uint64_t* absorbed);
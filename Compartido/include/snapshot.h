@@ -0,0 +1,75 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <string> // Include string header
+#include <vector> // Include vector header
+#include <cstdint> // Include cstdint header
+#include "particle_system.h" // Include particle system header
+#include "orbit_geometry.h" // Include orbit geometry header
+#include "rasterizer.h" // Include rasterizer header
+
+// Fotos del estado de la simulacion para detectar cambios en lo que se ve.
+// En modo benchmark (--snapshot-frames) se guarda, en ciertos frames, el
+// estado de cada particula, las orbitas y el framebuffer rasterizado en un
+// archivo binario compacto (el framebuffer va comprimido por corridas de
+// pixeles iguales). Con --golden esas fotos se comparan contra las de una
+// version anterior con la misma semilla y parametros, con tolerancia en las
+// posiciones y en los colores, sin necesitar pantalla.
+
+// ESTADO DE UN FRAME
+struct Snapshot {
+    uint64_t frame = 0; // FRAMES MOSTRADOS ANTES DE LA FOTO
+    uint64_t seed = 0; // SEMILLA
+    int width = 0, height = 0; // TAMANO DEL FRAMEBUFFER (0 SI NO SE DIBUJO)
+    int trailLength = 0; // LONGITUD DE LA ESTELA
+
+    std::vector<float> orbitX, orbitY, orbitRadius; // ORBITAS
+
+    std::vector<uint64_t> id; // IDENTIFICADOR DE CADA PARTICULA
+    std::vector<float> x, y; // COORDENADAS
+    std::vector<uint8_t> state; // ESTADO (ParticleState)
+    std::vector<int32_t> orbitIndex; // ORBITA (-1 SI NO ORBITA)
+    std::vector<uint32_t> color; // COLOR EMPAQUETADO EN ARGB8888
+
+    std::vector<uint32_t> pixels; // FRAMEBUFFER, width * height PIXELES
+};
+
+// TOLERANCIA DE LA COMPARACION CONTRA LAS FOTOS DE REFERENCIA
+struct GoldenTolerance {
+    float position = 0.5f; // DIFERENCIA MAXIMA DE POSICION (PIXELES)
+    int channel = 2; // DIFERENCIA MAXIMA POR CANAL DE COLOR (0..255)
+    double maxDiff = 0.001; // FRACCION DE PARTICULAS O PIXELES QUE PUEDEN PASARSE
+};
+
+// DIFERENCIAS ENTRE DOS FOTOS
+struct SnapshotDiff {
+    bool layoutMatches = true; // MISMO TAMANO, ORBITAS Y CANTIDAD DE PARTICULAS
+    size_t particlesOff = 0; // PARTICULAS CON OTRO ESTADO O FUERA DE TOLERANCIA
+    float maxPositionError = 0; // MAYOR DIFERENCIA DE POSICION
+    size_t pixelsOff = 0; // PIXELES FUERA DE TOLERANCIA
+    int maxChannelError = 0; // MAYOR DIFERENCIA EN UN CANAL
+    bool passed = true; // LA FOTO ESTA DENTRO DE LA TOLERANCIA
+};
+
+// FUNCION PARA TOMAR LA FOTO DE UN FRAME (fb PUEDE SER nullptr)
+Snapshot captureSnapshot(const ParticleSystem& ps, const OrbitGeometry& orbits, const FrameBuffer* fb,
+                         uint64_t frame, uint64_t seed);
+
+// FUNCION PARA GUARDAR UNA FOTO EN UN ARCHIVO BINARIO
+bool writeSnapshot(const std::string& path, const Snapshot& snapshot);
+
+// FUNCION PARA LEER UNA FOTO (false SI NO EXISTE O NO ES VALIDA)
+bool readSnapshot(const std::string& path, Snapshot& snapshot);
+
+// FUNCION PARA COMPARAR UNA FOTO CONTRA LA DE REFERENCIA
+SnapshotDiff compareSnapshots(const Snapshot& golden, const Snapshot& current, const GoldenTolerance& tolerance);
+
+// FUNCION PARA OBTENER EL NOMBRE DEL ARCHIVO DE LA FOTO DE UN FRAME
+std::string snapshotPath(const std::string& directory, uint64_t frame);
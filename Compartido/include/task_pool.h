@@ -0,0 +1,118 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <atomic> // Include atomic header
+#include <condition_variable> // Include condition variable header
+#include <deque> // Include deque header
+#include <functional> // Include functional header
+#include <memory> // Include memory header
+#include <mutex> // Include mutex header
+#include <thread> // Include thread header
+#include <vector> // Include vector header
+
+// Grafo de tareas de un frame. Cada tarea corre cuando terminan todas las
+// tareas de las que depende, asi las barreras entre fases se vuelven
+// dependencias: una banda del rasterizador puede empezar en cuanto se
+// actualizaron las particulas que necesita, sin esperar a todo el frame.
+class TaskGraph {
+public:
+    // TRABAJO DE UNA TAREA, RECIBE EL NUMERO DE TRABAJADOR QUE LA CORRE
+    using Work = std::function<void(int)>;
+
+    // FUNCION PARA AGREGAR UNA TAREA, DEVUELVE SU NUMERO
+    int add(Work work);
+
+    // FUNCION PARA QUE after CORRA HASTA QUE TERMINE before
+    void depend(int after, int before);
+
+    // FUNCION PARA VACIAR EL GRAFO (CONSERVA LA MEMORIA)
+    void clear();
+
+    // FUNCION PARA OBTENER LA CANTIDAD DE TAREAS
+    size_t size() const { return works.size(); }
+
+private:
+    friend class TaskPool;
+
+    std::vector<Work> works; // TRABAJO DE CADA TAREA
+    std::vector<std::vector<int>> successors; // TAREAS QUE ESPERAN A CADA UNA
+    std::vector<int> dependencies; // CANTIDAD DE TAREAS QUE ESPERA CADA UNA
+};
+
+// Pool de hilos persistente con robo de trabajo (--backend tasks). Los hilos
+// se crean una sola vez y duermen cuando no hay tareas, en lugar de armar un
+// equipo nuevo en cada region paralela. Cada hilo tiene su propia cola: mete
+// y saca por atras (la tarea mas nueva, cuyos datos siguen en su cache) y,
+// si se queda sin trabajo, le roba a otro hilo por adelante (la mas vieja).
+// Un hilo del pool que espera un grafo anidado corre tareas mientras espera.
+class TaskPool {
+public:
+    explicit TaskPool(int workers);
+    TaskPool(const TaskPool&) = delete;
+    TaskPool& operator=(const TaskPool&) = delete;
+    ~TaskPool();
+
+    // FUNCION PARA OBTENER LA CANTIDAD DE HILOS DEL POOL
+    int workers() const { return static_cast<int>(threads.size()); }
+
+    // FUNCION PARA QUE SOLO LOS PRIMEROS count HILOS TOMEN TAREAS; LOS DEMAS
+    // SE DUERMEN (LAS TAREAS QUE QUEDEN EN SUS COLAS SE LAS ROBAN LOS ACTIVOS)
+    void setActive(int count);
+
+    // FUNCION PARA OBTENER LA CANTIDAD DE HILOS QUE TOMAN TAREAS
+    int activeWorkers() const { return active.load(std::memory_order_relaxed); }
+
+    // FUNCION PARA CORRER UN GRAFO Y ESPERAR A QUE TERMINEN TODAS SUS TAREAS
+    void run(TaskGraph& graph);
+
+private:
+    // UNA CORRIDA DE UN GRAFO
+    struct Run {
+        TaskGraph* graph; // GRAFO QUE SE CORRE
+        std::unique_ptr<std::atomic<int>[]> pending; // DEPENDENCIAS SIN TERMINAR DE CADA TAREA
+        std::atomic<size_t> remaining; // TAREAS SIN TERMINAR
+        std::mutex mutex; // PROTEGE done
+        std::condition_variable finished; // AVISA CUANDO done CAMBIA
+        bool done = false; // YA TERMINARON TODAS LAS TAREAS
+    };
+
+    // TAREA LISTA PARA CORRER
+    struct Ready {
+        Run* run; // CORRIDA A LA QUE PERTENECE
+        int task; // NUMERO DE TAREA EN EL GRAFO
+    };
+
+    // COLA DE UN HILO, EN SU PROPIA LINEA DE CACHE
+    struct alignas(64) Queue {
+        std::mutex mutex; // PROTEGE tasks
+        std::deque<Ready> tasks; // TAREAS LISTAS
+    };
+
+    // CICLO DE CADA HILO DEL POOL
+    void workerLoop(int worker);
+
+    // FUNCION PARA METER UNA TAREA LISTA EN LA COLA DE UN HILO
+    void push(int queue, Ready ready);
+
+    // FUNCION PARA TOMAR UNA TAREA DE LA COLA PROPIA O ROBARLA DE OTRA
+    bool take(int worker, Ready& ready);
+
+    // FUNCION PARA CORRER UNA TAREA Y LIBERAR LAS QUE LA ESPERABAN
+    void execute(int worker, const Ready& ready);
+
+    std::vector<Queue> queues; // UNA COLA POR HILO
+    std::vector<std::thread> threads; // HILOS DEL POOL
+    std::atomic<size_t> queued{0}; // TAREAS EN TODAS LAS COLAS
+    std::atomic<int> nextQueue{0}; // COLA PARA LAS TAREAS QUE LLEGAN DE AFUERA
+    std::atomic<int> active{1}; // HILOS QUE TOMAN TAREAS
+    std::mutex sleepMutex; // PROTEGE stopping Y EL SUENO DE LOS HILOS
+    std::condition_variable wake; // DESPIERTA A LOS HILOS CUANDO HAY TAREAS
+    bool stopping = false; // SE ESTA DESTRUYENDO EL POOL
+};
@@ -0,0 +1,77 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#pragma once
+
+#include <atomic> // Include atomic header
+#include <chrono> // Include chrono header
+#include <cstddef> // Include cstddef header
+#include <cstdint> // Include cstdint header
+#include <string> // Include string header
+
+// Instrumentacion de la ruta caliente (--trace archivo). Cada hilo anota sus
+// intervalos en su propio buffer circular (sin candados; si se llena se
+// pisan los mas viejos) y suma sus propios contadores. Al final de cada
+// frame los contadores de todos los hilos se juntan en un evento, y al
+// salir todo se escribe en formato Chrome trace-event (chrome://tracing o
+// Perfetto), donde se ve cada hilo en su propia fila. Sin --trace cada
+// TraceScope solo lee una bandera.
+
+// CONTADORES POR FRAME
+enum TraceCounter {
+    COUNTER_CAPTURES = 0, // PARTICULAS CAPTURADAS POR UNA ORBITA
+    COUNTER_ESCAPES, // PARTICULAS QUE ESCAPARON DE SU ORBITA
+    COUNTER_ABSORPTIONS, // PARTICULAS ABSORBIDAS
+    COUNTER_SPAWNS, // PARTICULAS NUEVAS (INCLUYE LAS QUE REEMPLAZAN A LAS ABSORBIDAS)
+    COUNTER_COUNT
+};
+
+// EVENTOS QUE GUARDA CADA HILO ANTES DE EMPEZAR A PISAR LOS MAS VIEJOS
+constexpr size_t TRACE_EVENTS_PER_THREAD = 1 << 16;
+
+// BANDERA DE LA TRAZA, LA LEEN TODOS LOS CRONOMETROS
+extern std::atomic<bool> traceActive;
+
+// FUNCION PARA SABER SI SE ESTA GRABANDO LA TRAZA
+inline bool traceEnabled() {
+    return traceActive.load(std::memory_order_relaxed);
+}
+
+// FUNCION PARA EMPEZAR A GRABAR (EL HILO QUE LLAMA QUEDA COMO "main")
+void traceEnable();
+
+// FUNCION PARA ANOTAR UN INTERVALO DEL HILO ACTUAL
+void traceRecord(const char* name, std::chrono::steady_clock::time_point start,
+                 std::chrono::steady_clock::time_point end);
+
+// FUNCION PARA SUMAR A UN CONTADOR DEL HILO ACTUAL
+void traceCount(TraceCounter counter, uint64_t amount);
+
+// FUNCION PARA JUNTAR LOS CONTADORES DE TODOS LOS HILOS AL TERMINAR UN FRAME
+void traceFrameEnd(uint64_t frame);
+
+// FUNCION PARA ESCRIBIR LA TRAZA EN FORMATO CHROME TRACE-EVENT
+bool traceWrite(const std::string& path);
+
+// CRONOMETRO RAII: ANOTA EL INTERVALO DE SU VIDA CON EL NOMBRE DADO, QUE
+// DEBE SER UNA CADENA LITERAL
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) : name(traceEnabled() ? name : nullptr) {
+        if (this->name != nullptr) start = std::chrono::steady_clock::now();
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+    ~TraceScope() {
+        if (name != nullptr) traceRecord(name, start, std::chrono::steady_clock::now());
+    }
+
+private:
+    const char* name; // NOMBRE DEL INTERVALO (nullptr: SIN TRAZA)
+    std::chrono::steady_clock::time_point start; // INICIO DEL INTERVALO
+};
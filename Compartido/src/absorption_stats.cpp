@@ -0,0 +1,43 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "absorption_stats.h" // Include absorption stats header
+#include <algorithm> // Include algorithm header
+
+AbsorptionStats::AbsorptionStats(int orbitCount)
+    : orbits(orbitCount), stride((std::max(orbitCount, 1) + 7) / 8 * 8), totals(std::max(orbitCount, 0)) {}
+
+// FUNCION PARA PONER EN CERO LOS CONTADORES DE threads HILOS
+void AbsorptionStats::beginFrame(int threads) {
+    this->threads = std::max(threads, 1);
+    size_t needed = static_cast<size_t>(this->threads) * stride; // CONTADORES NECESARIOS
+    if (counts.size() < needed) counts.resize(needed);
+    std::fill(counts.begin(), counts.begin() + needed, 0);
+}
+
+// FUNCION PARA SUMAR LOS CONTADORES DE TODOS LOS HILOS A LOS TOTALES
+void AbsorptionStats::endFrame() {
+    for (int o = 0; o < orbits; ++o) {
+        uint64_t sum = 0; // ABSORCIONES DE LA ORBITA EN ESTE FRAME
+        for (int t = 0; t < threads; ++t) sum += local(t)[o];
+        if (sum > 0) totals[o].fetch_add(sum, std::memory_order_relaxed);
+    }
+}
+
+// FUNCION PARA CALCULAR LAS ABSORCIONES POR SEGUNDO DE CADA ORBITA DESDE
+// LA LECTURA ANTERIOR (last GUARDA LOS TOTALES DE ESA LECTURA)
+std::vector<double> AbsorptionStats::ratesSince(std::vector<uint64_t>& last, double seconds) const {
+    last.resize(orbits, 0);
+    std::vector<double> rates(orbits, 0.0); // ABSORCIONES POR SEGUNDO
+    for (int o = 0; o < orbits; ++o) {
+        uint64_t now = total(o); // TOTAL ACTUAL
+        if (seconds > 0) rates[o] = (now - last[o]) / seconds;
+        last[o] = now;
+    }
+    return rates;
+}
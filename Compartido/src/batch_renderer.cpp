@@ -0,0 +1,89 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "batch_renderer.h" // Include batch renderer header
+#include <algorithm> // Include algorithm header
+
+// FUNCION PARA DIBUJAR LAS ESTELAS CON SDL_RenderDrawPoints
+void BatchRenderer::drawPoints(SDL_Renderer* renderer, const ParticleSystem& ps, int trailLength, float blend) {
+    constexpr int shift = 8 - COLOR_BITS; // BITS QUE SE DESCARTAN POR CANAL
+    constexpr int alphaStep = 256 / ALPHA_LEVELS; // ANCHO DE CADA NIVEL DE ALFA
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+    // AGRUPAR POR COLOR Y ALFA CUANTIZADOS
+    buckets.resize(BUCKET_COUNT);
+    for (auto& bucket : buckets) bucket.clear(); // CONSERVA LA MEMORIA ENTRE FRAMES
+    for (size_t i = 0; i < ps.size(); ++i) {
+        const SDL_Color& color = ps.color[i]; // COLOR
+        int colorKey = ((color.r >> shift) << (2 * COLOR_BITS)) | ((color.g >> shift) << COLOR_BITS) | (color.b >> shift);
+        const int points = std::min(ps.trailCount[i], trailLength); // PUNTOS QUE SE DIBUJAN
+        for (int t = 0; t < points; ++t) {
+            int alpha = 255 * (1 - static_cast<float>(t) / trailLength); // TRANSPARENCIA
+            int alphaKey = std::clamp(alpha, 0, 255) / alphaStep; // NIVEL DE ALFA
+            buckets[colorKey * ALPHA_LEVELS + alphaKey].push_back(ps.renderPoint(i, t, blend));
+        }
+    }
+
+    // UNA LLAMADA POR GRUPO NO VACIO, CON EL COLOR DEL CENTRO DEL GRUPO
+    for (int key = 0; key < BUCKET_COUNT; ++key) {
+        const std::vector<SDL_Point>& bucket = buckets[key];
+        if (bucket.empty()) continue;
+        int colorKey = key / ALPHA_LEVELS, alphaKey = key % ALPHA_LEVELS;
+        constexpr int mask = (1 << COLOR_BITS) - 1;
+        constexpr int half = 1 << (shift - 1);
+        Uint8 r = static_cast<Uint8>((((colorKey >> (2 * COLOR_BITS)) & mask) << shift) | half);
+        Uint8 g = static_cast<Uint8>((((colorKey >> COLOR_BITS) & mask) << shift) | half);
+        Uint8 b = static_cast<Uint8>(((colorKey & mask) << shift) | half);
+        Uint8 a = static_cast<Uint8>(std::min(255, alphaKey * alphaStep + alphaStep / 2));
+        SDL_SetRenderDrawColor(renderer, r, g, b, a); // COLOR
+        SDL_RenderDrawPoints(renderer, bucket.data(), static_cast<int>(bucket.size()));
+    }
+}
+
+// FUNCION PARA DIBUJAR LAS ESTELAS CON UN SOLO SDL_RenderGeometry
+void BatchRenderer::drawGeometry(SDL_Renderer* renderer, const ParticleSystem& ps, int trailLength, float blend) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    vertices.clear();
+    indices.clear();
+
+    // FUNCION PARA AGREGAR UN CUADRADO DE 1 PIXEL EN (x, y)
+    auto addPixel = [&](int x, int y, SDL_Color color) {
+        int base = static_cast<int>(vertices.size()); // PRIMER VERTICE DEL CUADRADO
+        float fx = static_cast<float>(x), fy = static_cast<float>(y);
+        vertices.push_back({{fx, fy}, color, {0, 0}});
+        vertices.push_back({{fx + 1, fy}, color, {0, 0}});
+        vertices.push_back({{fx + 1, fy + 1}, color, {0, 0}});
+        vertices.push_back({{fx, fy + 1}, color, {0, 0}});
+        indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    };
+
+    size_t pointCount = 0; // PUNTOS DEL LOTE
+    for (size_t i = 0; i < ps.size(); ++i) pointCount += std::min(ps.trailCount[i], trailLength);
+    vertices.reserve(pointCount * 4);
+    indices.reserve(pointCount * 6);
+
+    // ESTELAS, EN EL MISMO ORDEN QUE drawParticle
+    for (size_t i = 0; i < ps.size(); ++i) {
+        SDL_Color color = ps.color[i]; // COLOR
+        const int points = std::min(ps.trailCount[i], trailLength); // PUNTOS QUE SE DIBUJAN
+        for (int t = 0; t < points; ++t) {
+            const SDL_Point point = ps.renderPoint(i, t, blend); // PUNTO DE LA ESTELA
+            int alpha = 255 * (1 - static_cast<float>(t) / trailLength); // TRANSPARENCIA
+            color.a = static_cast<Uint8>(std::clamp(alpha, 0, 255));
+            addPixel(point.x, point.y, color);
+        }
+    }
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(renderer, nullptr, vertices.data(), static_cast<int>(vertices.size()),
+                       indices.data(), static_cast<int>(indices.size()));
+#else
+    drawPoints(renderer, ps, trailLength, blend);
+#endif
+}
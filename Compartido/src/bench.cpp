@@ -0,0 +1,122 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "bench.h" // Include bench header
+#include <algorithm> // Include algorithm header
+#include <cmath> // Include cmath header
+#include <iomanip> // Include iomanip header
+#include <numeric> // Include numeric header
+
+namespace {
+
+const char* PHASE_NAMES[PHASE_COUNT] = {"update", "render", "respawn", "present", "publish", "graph"};
+
+// RESUMEN DE UNA SERIE DE TIEMPOS (ms)
+struct Summary {
+    double mean, p50, p95, p99;
+};
+
+// FUNCION PARA CALCULAR PROMEDIO Y PERCENTILES (RANGO MAS CERCANO)
+Summary summarize(std::vector<double> values) {
+    if (values.empty()) return {0, 0, 0, 0};
+    std::sort(values.begin(), values.end());
+    auto percentile = [&](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * values.size()));
+        return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+    };
+    double mean = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    return {mean, percentile(50), percentile(95), percentile(99)};
+}
+
+} // namespace
+
+BenchRecorder::BenchRecorder(int maxFrames) : maxFrames(std::max(maxFrames, 0)) {
+    phases.reserve(this->maxFrames);
+    frameTimes.reserve(this->maxFrames);
+}
+
+// FUNCION PARA EMPEZAR A MEDIR UN FRAME
+void BenchRecorder::beginFrame() {
+    current.fill(0);
+    frameStart = Clock::now();
+}
+
+// FUNCION PARA SUMAR LOS TIEMPOS DE VARIAS FASES AL FRAME ACTUAL
+void BenchRecorder::addPhases(const PhaseTimes& times) {
+    for (int p = 0; p < PHASE_COUNT; ++p) current[p] += times[p];
+}
+
+// FUNCION PARA TERMINAR EL FRAME ACTUAL
+void BenchRecorder::endFrame(size_t particleCount) {
+    if (frameTimes.size() >= maxFrames) return;
+    phases.push_back(current);
+    frameTimes.push_back(std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count());
+    particleUpdates += particleCount;
+}
+
+// FUNCION PARA ESCRIBIR EL RESUMEN DE LA CORRIDA
+void BenchRecorder::write(std::ostream& out, int format, const BenchInfo& info) const {
+    Summary phaseSummary[PHASE_COUNT]; // RESUMEN DE CADA FASE
+    for (int p = 0; p < PHASE_COUNT; ++p) {
+        std::vector<double> values; // TIEMPOS DE LA FASE
+        values.reserve(phases.size());
+        for (const auto& frame : phases) values.push_back(frame[p]);
+        phaseSummary[p] = summarize(std::move(values));
+    }
+    Summary frameSummary = summarize(frameTimes); // RESUMEN DEL FRAME COMPLETO
+    double totalSeconds = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0) / 1000.0; // TIEMPO TOTAL
+    double particlesPerSecond = totalSeconds > 0 ? particleUpdates / totalSeconds : 0; // PARTICULAS POR SEGUNDO
+
+    out << std::fixed << std::setprecision(4);
+    if (format == BENCH_CSV) {
+        out << "metric,mean_ms,p50_ms,p95_ms,p99_ms\n";
+        for (int p = 0; p < PHASE_COUNT; ++p) {
+            const Summary& s = phaseSummary[p];
+            out << PHASE_NAMES[p] << ',' << s.mean << ',' << s.p50 << ',' << s.p95 << ',' << s.p99 << '\n';
+        }
+        out << "frame," << frameSummary.mean << ',' << frameSummary.p50 << ',' << frameSummary.p95 << ','
+            << frameSummary.p99 << '\n';
+        out << "particles_per_sec," << particlesPerSecond << ",,,\n";
+        for (size_t o = 0; o < info.absorptions.size(); ++o) {
+            out << "absorptions_per_sec_orbit_" << o << ',' << (totalSeconds > 0 ? info.absorptions[o] / totalSeconds : 0)
+                << ",,,\n";
+        }
+        return;
+    }
+
+    auto writeSummary = [&](const Summary& s) {
+        out << "{\"mean\": " << s.mean << ", \"p50\": " << s.p50 << ", \"p95\": " << s.p95 << ", \"p99\": " << s.p99
+            << "}";
+    };
+    out << "{\n";
+    out << "  \"backend\": \"" << info.backend << "\",\n";
+    out << "  \"threads\": " << info.threads << ",\n";
+    out << "  \"seed\": " << info.seed << ",\n";
+    out << "  \"particles\": " << info.particles << ",\n";
+    out << "  \"kernel\": \"" << info.kernel << "\",\n";
+    out << "  \"schedule\": \"" << info.schedule << "\",\n";
+    out << "  \"chunk\": " << info.chunk << ",\n";
+    out << "  \"render\": " << (info.render ? "true" : "false") << ",\n";
+    out << "  \"frames\": " << frameTimes.size() << ",\n";
+    out << "  \"total_s\": " << totalSeconds << ",\n";
+    out << "  \"particles_per_sec\": " << particlesPerSecond << ",\n";
+    out << "  \"absorptions_per_sec\": [";
+    for (size_t o = 0; o < info.absorptions.size(); ++o) {
+        out << (o > 0 ? ", " : "") << (totalSeconds > 0 ? info.absorptions[o] / totalSeconds : 0);
+    }
+    out << "],\n";
+    out << "  \"frame_ms\": ";
+    writeSummary(frameSummary);
+    out << ",\n  \"phases_ms\": {\n";
+    for (int p = 0; p < PHASE_COUNT; ++p) {
+        out << "    \"" << PHASE_NAMES[p] << "\": ";
+        writeSummary(phaseSummary[p]);
+        out << (p + 1 < PHASE_COUNT ? ",\n" : "\n");
+    }
+    out << "  }\n}\n";
+}
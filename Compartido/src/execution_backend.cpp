@@ -0,0 +1,161 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "execution_backend.h" // Include execution backend header
+#include <algorithm> // Include algorithm header
+#include <atomic> // Include atomic header
+#include <numeric> // Include numeric header
+#include <thread> // Include thread header
+#include <vector> // Include vector header
+#include "settings.h" // Include settings header
+#ifdef _OPENMP
+#include <omp.h> // Include OpenMP header
+#endif
+#if defined(SCREENSAVER_STD_EXECUTION) && __has_include(<execution>)
+#include <execution> // Include execution header
+#endif
+#if defined(SCREENSAVER_STD_EXECUTION) && defined(__cpp_lib_parallel_algorithm)
+#define HAVE_STD_EXECUTION 1
+#endif
+
+namespace {
+
+// FUNCION PARA OBTENER LOS HILOS PEDIDOS CON --threads, O LOS DEL SISTEMA
+int requestedWorkers() {
+    return NUM_THREADS > 0 ? NUM_THREADS : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+std::atomic<int> activeLimit{0}; // TRABAJADORES QUE CORREN A LA VEZ (0: TODOS)
+
+} // namespace
+
+// FUNCION PARA SABER SI UN BACKEND ESTA COMPILADO
+bool backendAvailable(int backend) {
+    switch (backend) {
+        case BACKEND_SEQUENTIAL: return true;
+        case BACKEND_TASKS: return true;
+#ifdef _OPENMP
+        case BACKEND_OPENMP: return true;
+#endif
+#ifdef HAVE_STD_EXECUTION
+        case BACKEND_STD: return true;
+#endif
+        default: return false;
+    }
+}
+
+// FUNCION PARA OBTENER EL NOMBRE DE UN BACKEND
+const char* backendName(int backend) {
+    switch (backend) {
+        case BACKEND_OPENMP: return "openmp";
+        case BACKEND_STD: return "std";
+        case BACKEND_TASKS: return "tasks";
+        default: return "sequential";
+    }
+}
+
+// FUNCION PARA OBTENER EL POOL DEL BACKEND tasks
+TaskPool& backendPool() {
+    static TaskPool pool(requestedWorkers()); // LOS HILOS SE CREAN UNA SOLA VEZ
+    return pool;
+}
+
+// FUNCION PARA OBTENER CUANTOS TRABAJADORES USA EL BACKEND ACTUAL
+int backendWorkers() {
+    if (BACKEND == BACKEND_TASKS) return backendPool().workers();
+#ifdef _OPENMP
+    if (BACKEND == BACKEND_OPENMP) return omp_get_max_threads();
+#endif
+#ifdef HAVE_STD_EXECUTION
+    if (BACKEND == BACKEND_STD) {
+        // EL ESTANDAR NO DEJA ESCOGER LOS HILOS, --threads SOLO FIJA LOS RANGOS
+        return requestedWorkers();
+    }
+#endif
+    return 1;
+}
+
+// FUNCION PARA LIMITAR CUANTOS TRABAJADORES CORREN A LA VEZ
+void backendSetActiveWorkers(int workers) {
+    activeLimit.store(std::max(workers, 0), std::memory_order_relaxed);
+    if (BACKEND == BACKEND_TASKS) {
+        backendPool().setActive(workers > 0 ? workers : backendPool().workers());
+    }
+}
+
+// FUNCION PARA OBTENER CUANTOS TRABAJADORES CORREN A LA VEZ
+int backendActiveWorkers() {
+    const int all = backendWorkers(); // TODOS LOS TRABAJADORES
+    const int limit = activeLimit.load(std::memory_order_relaxed); // LIMITE PEDIDO
+    return limit > 0 ? std::min(limit, all) : all;
+}
+
+// FUNCION PARA REPARTIR [0, count) ENTRE LOS TRABAJADORES
+void parallelFor(size_t count, const std::function<void(size_t, int)>& body, LoopSchedule schedule) {
+    if (count == 0) return;
+
+#ifdef _OPENMP
+    if (BACKEND == BACKEND_OPENMP && count > 1) {
+        const int active = backendActiveWorkers(); // HILOS DEL EQUIPO
+        if (schedule == LOOP_TUNED) {
+            #pragma omp parallel for schedule(runtime) num_threads(active) // REPARTO ELEGIDO CON --schedule Y --chunk
+            for (size_t i = 0; i < count; ++i) {
+                body(i, omp_get_thread_num());
+            }
+        } else {
+            #pragma omp parallel for schedule(static) num_threads(active) // REPARTO FIJO
+            for (size_t i = 0; i < count; ++i) {
+                body(i, omp_get_thread_num());
+            }
+        }
+        return;
+    }
+#endif
+
+#ifdef HAVE_STD_EXECUTION
+    if (BACKEND == BACKEND_STD && count > 1) {
+        // UN RANGO CONTIGUO POR TRABAJADOR. SE USA par Y NO par_unseq PORQUE
+        // LOS CUERPOS RESERVAN MEMORIA (LAS BANDAS DEL RASTERIZADOR), Y LA
+        // VECTORIZACION YA LA HACE EL KERNEL DE MOVIMIENTO
+        const size_t ranges = std::min(count, static_cast<size_t>(backendActiveWorkers())); // RANGOS
+        std::vector<int> workers(ranges); // NUMERO DE CADA TRABAJADOR
+        std::iota(workers.begin(), workers.end(), 0);
+        std::for_each(std::execution::par, workers.begin(), workers.end(), [&](int worker) {
+            size_t begin = count * worker / ranges; // PRIMER INDICE DEL RANGO
+            size_t end = count * (worker + 1) / ranges; // FIN DEL RANGO
+            for (size_t i = begin; i < end; ++i) {
+                body(i, worker);
+            }
+        });
+        return;
+    }
+#endif
+
+    if (BACKEND == BACKEND_TASKS && count > 1) {
+        // PEDAZOS DE --chunk INDICES (SOLO EL CICLO DE ACTUALIZACION), O CERCA
+        // DE 4 POR HILO PARA QUE HAYA QUE ROBAR
+        TaskPool& pool = backendPool();
+        const size_t chunk = schedule == LOOP_TUNED && SCHEDULE_CHUNK > 0 ? static_cast<size_t>(SCHEDULE_CHUNK)
+                                                : std::max<size_t>(1, count / (static_cast<size_t>(pool.activeWorkers()) * 4));
+        TaskGraph graph; // UNA TAREA POR PEDAZO, SIN DEPENDENCIAS
+        for (size_t begin = 0; begin < count; begin += chunk) {
+            const size_t end = std::min(begin + chunk, count); // FIN DEL PEDAZO
+            graph.add([&body, begin, end](int worker) {
+                for (size_t i = begin; i < end; ++i) {
+                    body(i, worker);
+                }
+            });
+        }
+        pool.run(graph);
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        body(i, 0);
+    }
+}
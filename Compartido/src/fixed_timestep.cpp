@@ -0,0 +1,27 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "fixed_timestep.h" // Include fixed timestep header
+#include <algorithm> // Include algorithm header
+#include <cmath> // Include cmath header
+
+FixedTimestep::FixedTimestep(double rate, int maxSubsteps)
+    : step(1.0 / rate), maxSubsteps(std::max(maxSubsteps, 1)) {}
+
+// FUNCION PARA SUMAR seconds AL ACUMULADOR Y OBTENER LOS PASOS A CORRER
+int FixedTimestep::advance(double seconds) {
+    accumulator += std::max(seconds, 0.0);
+    const double due = std::floor(accumulator / step); // PASOS QUE CABEN
+    accumulator -= due * step;
+
+    // SI NO ALCANZA EL FRAME PARA TODOS, SE DESCARTAN LOS QUE SOBRAN
+    const int run = static_cast<int>(std::min(due, static_cast<double>(maxSubsteps))); // PASOS A CORRER
+    droppedCount += static_cast<uint64_t>(due) - run;
+    stepCount += run;
+    return run;
+}
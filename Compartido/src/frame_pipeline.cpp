@@ -0,0 +1,114 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "frame_pipeline.h" // Include frame pipeline header
+#include <algorithm> // Include algorithm header
+#include <utility> // Include utility header
+#include "settings.h" // Include settings header
+#include "trace.h" // Include trace header
+
+FramePipeline::FramePipeline(const ParticleSystem& live)
+    : back{ParticleSystem(live.capacity, live.trailLength)}, ready{ParticleSystem(live.capacity, live.trailLength)},
+      front{ParticleSystem(live.capacity, live.trailLength)} {}
+
+FramePipeline::~FramePipeline() {
+    stop();
+}
+
+// FUNCION PARA EMPEZAR A SIMULAR EN EL HILO DEL PIPELINE
+void FramePipeline::start(ParticleSystem& live, Step step) {
+    worker = std::thread(&FramePipeline::run, this, std::ref(live), std::move(step));
+}
+
+// CICLO DEL HILO DE SIMULACION
+void FramePipeline::run(ParticleSystem& live, Step step) {
+    applyThreadSettings(); // LOS HILOS NUEVOS NO HEREDAN LOS HILOS NI EL REPARTO
+    uint64_t steps = 0; // PASOS SIMULADOS DESDE EL INICIO
+    while (true) {
+        PhaseTimes times{}; // FASES DE ESTE FRAME
+        steps += step(times); // SIMULAR UN FRAME
+
+        PhaseTimer timer; // CRONOMETRO DE LA COPIA
+        {
+            TraceScope scope("publish");
+            publish(live, steps); // COPIAR LO QUE CAMBIO (REUSA LA MEMORIA DE LA COPIA)
+        }
+        times[PHASE_PUBLISH] += timer.lap();
+
+        // PUBLICAR CUANDO EL FRAME ANTERIOR YA SE TOMO
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this] { return !hasReady || stopping; });
+        if (stopping) return;
+        std::swap(back, ready);
+        readyTimes = times;
+        hasReady = true;
+        changed.notify_all();
+    }
+}
+
+// FUNCION PARA COPIAR A back LO QUE CAMBIO DESDE SU ULTIMA PUBLICACION
+void FramePipeline::publish(const ParticleSystem& live, uint64_t steps) {
+    ParticleSystem& to = back.state; // COPIA QUE SE VA A PUBLICAR
+    to.id = live.id;
+    to.x = live.x;
+    to.y = live.y;
+    to.state = live.state;
+    to.orbitIndex = live.orbitIndex;
+    to.color = live.color;
+    to.trailHead = live.trailHead;
+    to.trailCount = live.trailCount;
+    to.alive = live.alive;
+    to.aliveCount = live.aliveCount;
+
+    // CADA PASO ESCRIBE A LO MUCHO EL PUNTO MAS NUEVO DE CADA ESTELA, ASI QUE
+    // LOS PUNTOS EN USO QUE NO ESTAN ENTRE LOS fresh MAS NUEVOS YA ESTAN EN LA
+    // COPIA DESDE LA ULTIMA VEZ. UNA PARTICULA REINICIADA EMPIEZA SIN ESTELA,
+    // ASI QUE TODOS SUS PUNTOS SON NUEVOS Y TAMBIEN CABEN EN fresh
+    const int length = live.trailLength; // LONGITUD DE LA ESTELA
+    const int fresh = back.published ? static_cast<int>(std::min<uint64_t>(steps - back.steps, length)) : length; // PUNTOS NUEVOS
+    for (size_t i = 0; i < live.size() && fresh > 0; ++i) {
+        const int count = std::min(live.trailCount[i], fresh); // PUNTOS A COPIAR
+        if (count == 0) continue;
+        const size_t base = i * length; // INICIO DE LA ESTELA EN EL BLOQUE
+        const int oldest = live.trailHead[i] - count + 1; // POSICION DEL MAS VIEJO A COPIAR
+        if (oldest >= 0) {
+            std::copy_n(live.trailPoints.begin() + base + oldest, count, to.trailPoints.begin() + base + oldest);
+        } else {
+            // EL TRAMO DA LA VUELTA AL BUFFER CIRCULAR
+            std::copy_n(live.trailPoints.begin() + base, live.trailHead[i] + 1, to.trailPoints.begin() + base);
+            std::copy_n(live.trailPoints.begin() + base + length + oldest, -oldest,
+                        to.trailPoints.begin() + base + length + oldest);
+        }
+    }
+    back.steps = steps;
+    back.published = true;
+}
+
+// FUNCION PARA ESPERAR EL SIGUIENTE FRAME (nullptr SI SE DETUVO)
+const ParticleSystem* FramePipeline::acquire(PhaseTimes& simTimes) {
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [this] { return hasReady || stopping; });
+    if (!hasReady) return nullptr;
+    std::swap(ready, front);
+    simTimes = readyTimes;
+    hasReady = false;
+    changed.notify_all();
+    return &front.state;
+}
+
+// FUNCION PARA DETENER LA SIMULACION Y ESPERAR AL HILO
+void FramePipeline::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
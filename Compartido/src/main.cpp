@@ -0,0 +1,554 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include <SDL2/SDL.h> // Include SDL2 header
+#include <vector> // Include vector header
+#include <cmath> // Include cmath header
+#include <random> // Include random header
+#include <iomanip> // Include iomanip header
+#include <sstream> // Include sstream header
+#include <algorithm> // Include algorithm header
+#include <fstream> // Include fstream header
+#include <iostream> // Include iostream header
+#include <memory> // Include memory header
+#include <string> // Include string header
+#include "settings.h" // Include settings header
+#include "execution_backend.h" // Include execution backend header
+#include "simulation.h" // Include simulation header
+#include "motion_kernel.h" // Include motion kernel header
+#include "rasterizer.h" // Include software rasterizer header
+#include "batch_renderer.h" // Include batch renderer header
+#include "orbit_background.h" // Include orbit background header
+#include "bench.h" // Include bench header
+#include "options.h" // Include options header
+#include "frame_pipeline.h" // Include frame pipeline header
+#include "absorption_stats.h" // Include absorption stats header
+#include "trace.h" // Include trace header
+#include "snapshot.h" // Include snapshot header
+#include "fixed_timestep.h" // Include fixed timestep header
+#include "quality_governor.h" // Include quality governor header
+#include <atomic> // Include atomic header
+#include <filesystem> // Include filesystem header
+using namespace std;
+
+// FUNCION PARA DIBUJAR UNA PARTICULA
+void drawParticle(SDL_Renderer* renderer, const ParticleSystem& ps, size_t i, int trailLength, float blend) {
+    const SDL_Color& color = ps.color[i]; // COLOR
+    // RECORRER LA ESTELA DEL PUNTO MAS NUEVO AL MAS VIEJO
+    const int points = std::min(ps.trailCount[i], trailLength); // PUNTOS QUE SE DIBUJAN
+    for (int t = 0; t < points; ++t) {
+        const SDL_Point point = ps.renderPoint(i, t, blend); // PUNTO DE LA ESTELA
+        int alpha = 255 * (1 - static_cast<float>(t) / trailLength); // TRANSPARENCIA
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, alpha); // COLOR
+        SDL_RenderDrawPoint(renderer, point.x, point.y); // DIBUJAR PUNTO
+    }
+}
+// FUNCION PRINCIPAL
+int main(int argc, char* args[]) {
+
+    // LEER OPCIONES DE LA LINEA DE COMANDOS Y DEL ARCHIVO DE CONFIGURACION (--help)
+    BenchOptions bench; // OPCIONES DEL MODO BENCHMARK
+    OptionsResult options = parseOptions(argc, args, bench);
+    if (options == OPTIONS_HELP) return 0;
+    if (options == OPTIONS_ERROR) return 1;
+    applyThreadSettings(); // HILOS Y REPARTO PEDIDOS CON --threads Y --schedule
+    if (!TRACE_FILE.empty()) {
+        traceEnable(); // GRABAR LA TRAZA PEDIDA CON --trace
+    }
+
+    // EN MODO BENCHMARK LA SALIDA ESTANDAR QUEDA LIBRE PARA EL REPORTE
+    std::ostream& logStream = bench.enabled ? std::cerr : std::cout;
+    logStream << "Seed: " << SEED << std::endl; // MOSTRAR SEMILLA PARA REPETIR LA CORRIDA
+    logStream << "Update kernel: " << motionKernelName() << std::endl; // MOSTRAR KERNEL DE MOVIMIENTO
+    logStream << "Backend: " << backendName(BACKEND) << std::endl; // MOSTRAR BACKEND DE EJECUCION
+    logStream << "Threads: " << backendWorkers() << std::endl; // MOSTRAR HILOS DEL BACKEND
+    if (BACKEND == BACKEND_OPENMP) {
+        logStream << "Schedule: " << scheduleName(UPDATE_SCHEDULE) << ", chunk "
+                  << (SCHEDULE_CHUNK > 0 ? std::to_string(SCHEDULE_CHUNK) : "default") << std::endl; // MOSTRAR REPARTO
+    }
+
+    // CARPETA DE LAS FOTOS (--snapshot-dir)
+    if (!bench.snapshotDir.empty()) {
+        std::error_code error; // ERROR AL CREAR LA CARPETA
+        std::filesystem::create_directories(bench.snapshotDir, error);
+        if (error) {
+            cerr << "No se pudo crear " << bench.snapshotDir << ": " << error.message() << "\n";
+            return 1;
+        }
+    }
+    const GoldenTolerance tolerance{bench.goldenPosition, bench.goldenChannel, bench.goldenMaxDiff}; // TOLERANCIA DE --golden
+    int goldenFailures = 0; // FOTOS QUE NO COINCIDEN CON SU REFERENCIA
+
+    // EN MODO BENCHMARK NO SE CREA VENTANA NI RENDERIZADOR
+    SDL_Window* window = nullptr; // VENTANA
+    SDL_Renderer* renderer = nullptr; // RENDERIZADOR
+    if (!bench.enabled) {
+        SDL_Init(SDL_INIT_VIDEO); // INICIAR SDL
+        window = SDL_CreateWindow("Particle Absorbing Screensaver - FPS: 0", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN); // CREAR VENTANA
+        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED); // CREAR RENDERIZADOR
+    }
+    // TEXTURA DONDE DIBUJA EL RASTERIZADOR POR SOFTWARE
+    SDL_Texture* frameTexture = nullptr;
+    if (!bench.enabled && RENDER_MODE == RENDER_SOFTWARE) {
+        frameTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, SCREEN_WIDTH, SCREEN_HEIGHT);
+        if (frameTexture == nullptr) {
+            cerr << "No se pudo crear la textura, se usara el renderizador de SDL: " << SDL_GetError() << "\n";
+            RENDER_MODE = RENDER_SDL;
+        }
+    }
+    // FRAMEBUFFER EN MEMORIA PARA EL MODO BENCHMARK
+    std::vector<Uint32> benchPixels(bench.enabled && bench.render ? static_cast<size_t>(SCREEN_WIDTH) * SCREEN_HEIGHT : 0);
+    TrailRasterizer trailRasterizer; // RASTERIZADOR DE ESTELAS
+    BatchRenderer batchRenderer; // DIBUJO POR LOTES CON SDL
+    ParticleSystem particles(INITIAL_PARTICLES, TRAIL_LENGTH); // SISTEMA DE PARTICULAS
+    uint64_t frame = 0; // NUMERO DE FRAME (CONTADOR DEL GENERADOR ALEATORIO)
+    float renderBlend = 1.0f; // INTERPOLACION DEL DIBUJO ENTRE LOS DOS ULTIMOS PASOS
+    std::atomic<int> particleTarget{INITIAL_PARTICLES}; // PARTICULAS VIVAS (LO BAJA --frame-budget)
+    int renderTrail = TRAIL_LENGTH; // PUNTOS DE ESTELA QUE SE DIBUJAN (LO BAJA --frame-budget)
+
+    // CREAR ORBITAS, SU GEOMETRIA YA NO CAMBIA
+    const OrbitGeometry orbits = makeOrbitLayout(NUM_ORBITS, SCREEN_WIDTH, SCREEN_HEIGHT, SEED);
+
+    // CUADRICULA PARA BUSCAR ORBITAS CERCANAS
+    OrbitGrid orbitGrid;
+    orbitGrid.build(orbits, SCREEN_WIDTH, SCREEN_HEIGHT, CAPTURE_RADIUS);
+
+    // ABSORCIONES DE CADA ORBITA
+    AbsorptionStats absorption(NUM_ORBITS);
+    std::vector<uint64_t> absorbedAtLastReport; // TOTALES EN EL ULTIMO REPORTE
+
+    // FONDO CON LAS ORBITAS, SE DIBUJA UNA SOLA VEZ
+    OrbitBackground orbitBackground;
+    orbitBackground.build(renderer, orbits, SCREEN_WIDTH, SCREEN_HEIGHT);
+
+    double startTime = SDL_GetTicks(); // INICIAR CRONOMETRO
+
+    //  CREAR PARTICULAS EN PARALELO, CADA HILO LLENA SU RANGO DE POSICIONES
+    spawnParticles(particles, INITIAL_PARTICLES);
+
+    double endTime = SDL_GetTicks(); // DETENER CRONOMETRO
+    double generationTime = endTime - startTime; // TIEMPO DE GENERACION DE PARTICULAS
+    logStream << "Time to generate particles: " << generationTime << " ms" << std::endl; // MOSTRAR TIEMPO DE GENERACION DE PARTICULAS
+
+    // PASO DE SIMULACION: ACTUALIZAR, ELIMINAR MUERTAS Y AGREGAR NUEVAS
+    auto simulateFrame = [&](PhaseTimes& times) {
+        PhaseTimer timer; // CRONOMETRO DE LAS FASES
+
+        // ACTUALIZAR PARTICULAS EN PARALELO. LAS ABSORBIDAS SE REINICIAN EN SU
+        // MISMA POSICION, ASI QUE NINGUN HILO VE CAMBIAR LOS INDICES
+        const size_t particleCount = particles.size(); // PARTICULAS A ACTUALIZAR
+        const size_t blockCount = (particleCount + UPDATE_BLOCK_SIZE - 1) / UPDATE_BLOCK_SIZE; // BLOQUES A ACTUALIZAR
+        absorption.beginFrame(backendWorkers()); // CADA TRABAJADOR CUENTA SUS ABSORCIONES
+        {
+            TraceScope scope("update");
+            parallelFor(blockCount, [&](size_t b, int worker) {
+                size_t begin = b * UPDATE_BLOCK_SIZE; // PRIMERA PARTICULA DEL BLOQUE
+                size_t end = std::min(begin + UPDATE_BLOCK_SIZE, particleCount); // FIN DEL BLOQUE
+                updateParticles(particles, begin, end, orbits, orbitGrid, frame, absorption.local(worker));
+            }, LOOP_TUNED); // EL UNICO CICLO CON EL REPARTO DE --schedule Y --chunk
+            absorption.endFrame(); // SUMAR LOS CONTADORES DE LOS TRABAJADORES
+        }
+        times[PHASE_UPDATE] += timer.lap();
+
+        // AGREGAR EN PARALELO LAS PARTICULAS QUE FALTAN, SI LAS HAY (LAS NUEVAS
+        // NO TIENEN ESTELA, NO CAMBIAN LO QUE SE DIBUJA EN ESTE FRAME)
+        {
+            TraceScope scope("respawn");
+            const int target = particleTarget.load(std::memory_order_relaxed); // PARTICULAS VIVAS PEDIDAS
+            releaseParticles(particles, target);
+            spawnParticles(particles, target);
+        }
+        times[PHASE_RESPAWN] += timer.lap();
+
+        frame++; // SIGUIENTE FRAME DE LA SIMULACION
+    };
+
+    // CON --backend tasks (Y SIN --pipeline) EL FRAME ES UN SOLO GRAFO DE
+    // TAREAS EN LUGAR DE FASES SEPARADAS POR BARRERAS. CADA RANGO DE
+    // PARTICULAS SE CLASIFICA POR BANDA EN CUANTO SE ACTUALIZAN SUS BLOQUES,
+    // LAS BANDAS DEL FONDO SE COPIAN MIENTRAS TANTO, Y LAS PARTICULAS NUEVAS
+    // SE AGREGAN MIENTRAS SE MEZCLAN LAS BANDAS, QUE YA NO LEEN LAS PARTICULAS
+    const bool useFrameGraph = BACKEND == BACKEND_TASKS && !PIPELINE; // CORRER EL FRAME COMO GRAFO
+    TaskGraph frameGraph; // TAREAS DEL FRAME (CONSERVA LA MEMORIA ENTRE FRAMES)
+    auto runFrameGraph = [&](const FrameBuffer* fb, PhaseTimes& times) {
+        PhaseTimer timer; // CRONOMETRO DEL GRAFO
+        TraceScope scope("graph");
+        TaskPool& pool = backendPool(); // HILOS DEL BACKEND
+        frameGraph.clear();
+
+        // 1. ACTUALIZAR LOS BLOQUES (--chunk BLOQUES POR TAREA, O UNO) Y SUMAR
+        // LOS CONTADORES AL FINAL
+        const size_t particleCount = particles.size(); // PARTICULAS A ACTUALIZAR
+        const size_t blockCount = (particleCount + UPDATE_BLOCK_SIZE - 1) / UPDATE_BLOCK_SIZE; // BLOQUES A ACTUALIZAR
+        const size_t blocksPerTask = SCHEDULE_CHUNK > 0 ? static_cast<size_t>(SCHEDULE_CHUNK) : 1; // BLOQUES POR TAREA
+        absorption.beginFrame(pool.workers()); // CADA HILO CUENTA SUS ABSORCIONES
+        const int updated = frameGraph.add([&](int) { absorption.endFrame(); }); // TODOS LOS BLOQUES LISTOS
+        std::vector<int> updateTasks(blockCount); // TAREA QUE ACTUALIZA CADA BLOQUE
+        for (size_t first = 0; first < blockCount; first += blocksPerTask) {
+            const size_t last = std::min(first + blocksPerTask, blockCount); // FIN DE LOS BLOQUES DE LA TAREA
+            const int task = frameGraph.add([&, first, last](int worker) {
+                size_t begin = first * UPDATE_BLOCK_SIZE; // PRIMERA PARTICULA DE LA TAREA
+                size_t end = std::min(last * UPDATE_BLOCK_SIZE, particleCount); // FIN DE LA TAREA
+                updateParticles(particles, begin, end, orbits, orbitGrid, frame, absorption.local(worker));
+            });
+            std::fill(updateTasks.begin() + first, updateTasks.begin() + last, task);
+            frameGraph.depend(updated, task);
+        }
+
+        // 2. LIBERAR O AGREGAR LAS PARTICULAS QUE SOBRAN O FALTAN (DESPUES DE
+        // CLASIFICAR, LAS NUEVAS NO TIENEN ESTELA Y NO CAMBIAN EL DIBUJO)
+        const int respawn = frameGraph.add([&](int) {
+            TraceScope scope("respawn");
+            const int target = particleTarget.load(std::memory_order_relaxed); // PARTICULAS VIVAS PEDIDAS
+            releaseParticles(particles, target);
+            spawnParticles(particles, target);
+        });
+        frameGraph.depend(respawn, updated);
+
+        if (fb != nullptr) {
+            // 3. CLASIFICAR RANGOS DE BLOQUES, CERCA DE 2 POR HILO
+            const size_t blocksPerRange = std::max<size_t>(1, blockCount / (static_cast<size_t>(pool.activeWorkers()) * 2));
+            const size_t ranges = std::max<size_t>(1, (blockCount + blocksPerRange - 1) / blocksPerRange); // RANGOS
+            trailRasterizer.begin(*fb, renderTrail, static_cast<int>(ranges), renderBlend);
+            const int binned = frameGraph.add([](int) {}); // TODOS LOS RANGOS CLASIFICADOS
+            for (size_t r = 0; r < ranges; ++r) {
+                const size_t firstBlock = r * blocksPerRange; // PRIMER BLOQUE DEL RANGO
+                const size_t lastBlock = std::min(firstBlock + blocksPerRange, blockCount); // FIN DE LOS BLOQUES
+                const size_t first = std::min(firstBlock * UPDATE_BLOCK_SIZE, particleCount); // PRIMERA PARTICULA
+                const size_t last = std::min(lastBlock * UPDATE_BLOCK_SIZE, particleCount); // FIN DEL RANGO
+                const int bin = frameGraph.add([&, first, last, r](int) {
+                    trailRasterizer.binRange(particles, first, last, static_cast<int>(r));
+                });
+                for (size_t b = firstBlock; b < lastBlock; ++b) {
+                    frameGraph.depend(bin, updateTasks[b]);
+                }
+                frameGraph.depend(binned, bin);
+            }
+            // LAS PARTICULAS NUEVAS PUEDEN CAMBIAR EL TAMANO DEL POOL
+            frameGraph.depend(respawn, binned);
+
+            // 4. COPIAR EL FONDO DE CADA BANDA Y MEZCLARLA
+            const int bandHeight = trailRasterizer.bandHeight(); // FILAS POR BANDA
+            for (int band = 0; band < trailRasterizer.bandCount(); ++band) {
+                const int copy = frameGraph.add([&, fb, band, bandHeight](int) {
+                    TraceScope scope("orbit_draw");
+                    orbitBackground.copyRows(*fb, band * bandHeight, (band + 1) * bandHeight);
+                });
+                const int blend = frameGraph.add([&, band](int) { trailRasterizer.blendBand(band); });
+                frameGraph.depend(blend, copy);
+                frameGraph.depend(blend, binned);
+            }
+        }
+
+        pool.run(frameGraph);
+        frame++; // SIGUIENTE FRAME DE LA SIMULACION
+        times[PHASE_GRAPH] += timer.lap();
+    };
+
+    // FUNCION PARA DIBUJAR UN ESTADO DE LA SIMULACION
+    auto renderFrame = [&](const ParticleSystem& state) {
+        if (bench.enabled) {
+            // SIN VENTANA: RASTERIZAR EN MEMORIA SI SE PIDIO
+            if (bench.render) {
+                FrameBuffer fb{benchPixels.data(), SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_WIDTH};
+                {
+                    TraceScope scope("orbit_draw");
+                    orbitBackground.copyTo(fb); // COPIAR FONDO CON LAS ORBITAS
+                }
+                TraceScope scope("particle_draw");
+                trailRasterizer.draw(fb, state, renderTrail, renderBlend); // DIBUJAR PARTICULAS
+            }
+        } else if (RENDER_MODE == RENDER_SOFTWARE) {
+            // RASTERIZAR DIRECTO EN LA TEXTURA Y SUBIRLA CON UNA SOLA COPIA
+            void* pixels; // PIXELES DE LA TEXTURA
+            int pitch; // BYTES POR FILA
+            if (SDL_LockTexture(frameTexture, nullptr, &pixels, &pitch) == 0) {
+                FrameBuffer fb{static_cast<Uint32*>(pixels), SCREEN_WIDTH, SCREEN_HEIGHT, pitch / 4};
+                {
+                    TraceScope scope("orbit_draw");
+                    orbitBackground.copyTo(fb); // COPIAR FONDO CON LAS ORBITAS
+                }
+                TraceScope scope("particle_draw");
+                trailRasterizer.draw(fb, state, renderTrail, renderBlend); // DIBUJAR PARTICULAS
+                SDL_UnlockTexture(frameTexture);
+            }
+            SDL_RenderCopy(renderer, frameTexture, nullptr, nullptr); // COPIAR A LA PANTALLA
+        } else if (RENDER_MODE == RENDER_POINTS || RENDER_MODE == RENDER_GEOMETRY) {
+            {
+                TraceScope scope("orbit_draw");
+                orbitBackground.draw(renderer); // COPIAR FONDO CON LAS ORBITAS
+            }
+
+            // DIBUJAR PARTICULAS EN POCAS LLAMADAS A SDL
+            TraceScope scope("particle_draw");
+            if (RENDER_MODE == RENDER_POINTS) {
+                batchRenderer.drawPoints(renderer, state, renderTrail, renderBlend);
+            } else {
+                batchRenderer.drawGeometry(renderer, state, renderTrail, renderBlend);
+            }
+        } else {
+            {
+                TraceScope scope("orbit_draw");
+                orbitBackground.draw(renderer); // COPIAR FONDO CON LAS ORBITAS
+            }
+
+            // DIBUJAR PARTICULAS (SDL SOLO SE PUEDE USAR DESDE UN HILO)
+            TraceScope scope("particle_draw");
+            for (size_t i = 0; i < state.size(); ++i) {
+                drawParticle(renderer, state, i, renderTrail, renderBlend); // DIBUJAR PARTICULA
+            }
+        }
+    };
+
+    // CON --sim-rate LA SIMULACION AVANZA CON EL TIEMPO REAL Y NO CON LOS
+    // FRAMES: CADA FRAME CORRE LOS PASOS QUE LE TOCAN (0, 1 O VARIOS) Y EL
+    // DIBUJO SE INTERPOLA. EN MODO BENCHMARK SIEMPRE ES UN PASO POR FRAME,
+    // ASI LOS REPORTES Y LAS FOTOS NO DEPENDEN DEL RELOJ
+    const bool fixedStep = !bench.enabled && SIM_RATE > 0; // USAR PASO DE TIEMPO FIJO
+    FixedTimestep timestep(fixedStep ? SIM_RATE : 1, MAX_SUBSTEPS);
+    std::atomic<int> pipelineSubsteps{1}; // PASOS QUE SIMULA EL PIPELINE POR FRAME
+
+    // CON --pipeline OTRO HILO SIMULA EL SIGUIENTE FRAME MIENTRAS ESTE DIBUJA
+    std::unique_ptr<FramePipeline> pipeline;
+    if (PIPELINE) {
+        pipeline = std::make_unique<FramePipeline>(particles);
+        pipeline->start(particles, [&](PhaseTimes& times) {
+            const int substeps = pipelineSubsteps.load(std::memory_order_relaxed); // PASOS DE ESTE FRAME
+            for (int s = 0; s < substeps; ++s) simulateFrame(times);
+            return substeps;
+        });
+    }
+
+    int frameCount = 0; // CONTADOR DE FRAMES
+    uint64_t frameNumber = 0; // FRAMES MOSTRADOS (PARA LA TRAZA)
+    int benchFrames = 0; // FRAMES CORRIDOS EN MODO BENCHMARK (CALENTAMIENTO INCLUIDO)
+    std::vector<uint64_t> absorbedAtWarmup(NUM_ORBITS, 0); // TOTALES AL TERMINAR EL CALENTAMIENTO
+    double currentTime = startTime; // TIEMPO ACTUAL
+    uint64_t stepsAtLastReport = 0, droppedAtLastReport = 0; // PASOS EN EL ULTIMO REPORTE
+
+    bool quit = false; // BANDERA DE SALIDA
+    SDL_Event e; // EVENTO
+    BenchRecorder recorder(bench.enabled ? bench.frames : 0); // TIEMPOS DE CADA FASE
+    // CON --frame-budget EL CONTROL DE CALIDAD AJUSTA PARTICULAS, ESTELA E
+    // HILOS; EMPIEZA CON LA CALIDAD MAXIMA
+    std::unique_ptr<QualityGovernor> governor;
+    if (FRAME_BUDGET > 0) {
+        QualityLevels best{INITIAL_PARTICLES, TRAIL_LENGTH, backendWorkers()}; // CALIDAD MAXIMA
+        QualityLevels worst{std::max(1, INITIAL_PARTICLES / 10), std::min(TRAIL_LENGTH, 2), 1}; // CALIDAD MINIMA
+        governor = std::make_unique<QualityGovernor>(FRAME_BUDGET, best, worst);
+    }
+
+    PhaseTimer frameClock; // TIEMPO REAL ENTRE FRAMES (PASO DE TIEMPO FIJO)
+    // CICLO PRINCIPAL DEL JUEGO
+    while (!quit) {
+        while (!bench.enabled && SDL_PollEvent(&e) != 0) {
+            if (e.type == SDL_QUIT) {
+                quit = true; // SALIR
+            } else if (e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET) {
+                orbitBackground.reloadTexture(renderer); // LA TEXTURA DEL FONDO SE PUDO PERDER
+            }
+        }
+
+        recorder.beginFrame();
+        PhaseTimer workTimer; // TRABAJO DEL FRAME, SIN ESPERAR AL PRESENT (CONTROL DE CALIDAD)
+
+        // PASOS DE SIMULACION DE ESTE FRAME
+        int substeps = 1; // PASOS A CORRER
+        if (fixedStep) {
+            substeps = timestep.advance(frameClock.lap() / 1000.0);
+            renderBlend = timestep.blend();
+        }
+
+        // SIMULAR EL FRAME, O TOMAR EL QUE YA SIMULO EL PIPELINE
+        PhaseTimes simTimes{}; // FASES DE LA SIMULACION
+        const ParticleSystem* state = &particles; // ESTADO A DIBUJAR
+        bool drawn = false; // EL GRAFO YA RASTERIZO EL FRAME
+        if (pipeline) {
+            pipelineSubsteps.store(substeps, std::memory_order_relaxed); // APLICA AL FRAME QUE SIGUE
+            state = pipeline->acquire(simTimes);
+            if (state == nullptr) break;
+        } else if (useFrameGraph && substeps > 0) {
+            // LOS PASOS EXTRA SOLO SIMULAN; EL ULTIMO TAMBIEN DIBUJA
+            for (int s = 1; s < substeps; ++s) {
+                runFrameGraph(nullptr, simTimes);
+            }
+
+            // EL GRAFO TAMBIEN DIBUJA CUANDO EL FRAME SE RASTERIZA POR SOFTWARE
+            FrameBuffer fb{}; // FRAMEBUFFER DEL FRAME
+            void* pixels = nullptr; // PIXELES DE LA TEXTURA
+            int pitch = 0; // BYTES POR FILA
+            if (bench.enabled) {
+                if (bench.render) fb = {benchPixels.data(), SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_WIDTH};
+            } else if (RENDER_MODE == RENDER_SOFTWARE && SDL_LockTexture(frameTexture, nullptr, &pixels, &pitch) == 0) {
+                fb = {static_cast<Uint32*>(pixels), SCREEN_WIDTH, SCREEN_HEIGHT, pitch / 4};
+            }
+            drawn = fb.pixels != nullptr;
+            runFrameGraph(drawn ? &fb : nullptr, simTimes);
+            if (pixels != nullptr) {
+                SDL_UnlockTexture(frameTexture);
+            }
+        } else if (!useFrameGraph) {
+            for (int s = 0; s < substeps; ++s) {
+                simulateFrame(simTimes);
+            }
+        }
+        recorder.addPhases(simTimes);
+
+        // DIBUJAR EL FRAME
+        PhaseTimer timer; // CRONOMETRO DEL DIBUJO
+        if (!drawn) {
+            renderFrame(*state);
+        } else if (!bench.enabled) {
+            SDL_RenderCopy(renderer, frameTexture, nullptr, nullptr); // COPIAR A LA PANTALLA
+        }
+        recorder.addPhase(PHASE_RENDER, timer.lap());
+        const double workMs = workTimer.lap(); // SIMULAR Y DIBUJAR
+
+        if (!bench.enabled) {
+            TraceScope scope("present");
+            SDL_RenderPresent(renderer); // ACTUALIZAR PANTALLA
+        }
+        recorder.addPhase(PHASE_PRESENT, timer.lap());
+        if (benchFrames >= bench.warmup) {
+            recorder.endFrame(state->aliveCount); // LOS FRAMES DE CALENTAMIENTO NO SE MIDEN
+        }
+        traceFrameEnd(frameNumber++); // CONTADORES DEL FRAME EN LA TRAZA
+
+        // AJUSTAR LA CALIDAD; LAS PARTICULAS CAMBIAN EN EL SIGUIENTE PASO DE SIMULACION
+        if (governor && governor->addFrame(workMs)) {
+            const QualityLevels& levels = governor->levels(); // NIVELES NUEVOS
+            particleTarget.store(levels.particles, std::memory_order_relaxed);
+            renderTrail = levels.trailLength;
+            backendSetActiveWorkers(levels.threads);
+            logStream << "Quality: " << governor->lastDecision() << " (avg " << governor->averageMs() << " ms)" << std::endl;
+        }
+
+        // FOTO DEL FRAME (FUERA DEL TIEMPO MEDIDO)
+        if (std::find(bench.snapshotFrames.begin(), bench.snapshotFrames.end(), frameNumber) != bench.snapshotFrames.end()) {
+            FrameBuffer fb{benchPixels.data(), SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_WIDTH};
+            Snapshot snapshot = captureSnapshot(*state, orbits, bench.render ? &fb : nullptr, frameNumber, SEED);
+            if (!bench.snapshotDir.empty() && !writeSnapshot(snapshotPath(bench.snapshotDir, frameNumber), snapshot)) {
+                cerr << "No se pudo escribir " << snapshotPath(bench.snapshotDir, frameNumber) << "\n";
+                goldenFailures++;
+            }
+            if (!bench.goldenDir.empty()) {
+                Snapshot golden; // FOTO DE REFERENCIA
+                const std::string goldenPath = snapshotPath(bench.goldenDir, frameNumber); // ARCHIVO DE REFERENCIA
+                if (!readSnapshot(goldenPath, golden)) {
+                    logStream << "Golden frame " << frameNumber << ": no se pudo leer " << goldenPath << " (no existe o esta danado)" << std::endl;
+                    goldenFailures++;
+                } else {
+                    SnapshotDiff diff = compareSnapshots(golden, snapshot, tolerance);
+                    logStream << "Golden frame " << frameNumber << ": " << (diff.passed ? "ok" : "FAIL");
+                    if (diff.layoutMatches) {
+                        logStream << " (particles off " << diff.particlesOff << ", max position error "
+                                  << diff.maxPositionError << ", pixels off " << diff.pixelsOff
+                                  << ", max channel error " << diff.maxChannelError << ")";
+                    } else {
+                        logStream << " (distinto tamano, orbitas o cantidad de particulas)";
+                    }
+                    logStream << std::endl;
+                    if (!diff.passed) goldenFailures++;
+                }
+            }
+        }
+
+        frameCount++; // INCREMENTAR CONTADOR DE FRAMES
+
+        if (bench.enabled) {
+            if (++benchFrames == bench.warmup) {
+                for (int o = 0; o < absorption.orbitCount(); ++o) absorbedAtWarmup[o] = absorption.total(o);
+            }
+            if (benchFrames >= bench.warmup + bench.frames) {
+                quit = true; // YA SE MIDIERON TODOS LOS FRAMES
+            }
+            continue;
+        }
+
+        double now = SDL_GetTicks(); // OBTENER TIEMPO ACTUAL
+        if (now - currentTime >= 1000) {
+            double fps = frameCount / ((now - currentTime) / 1000.0); // CALCULAR FPS
+            std::ostringstream stream; // FLUJO DE SALIDA
+            stream << std::fixed << std::setprecision(2) << fps; // FORMATEAR FPS 
+            std::string fps_string = stream.str(); // CONVERTIR FPS A CADENA
+            std::string title = "Particle Absorbing Screensaver - FPS: " + fps_string; // TITULO DE LA VENTANA
+            SDL_SetWindowTitle(window, title.c_str()); // ACTUALIZAR TITULO DE LA VENTANA
+            std::cout << "FPS: " << fps << std::endl; // MOSTRAR FPS
+            std::ostringstream rates; // MOSTRAR ABSORCIONES POR SEGUNDO DE CADA ORBITA
+            rates << std::fixed << std::setprecision(1);
+            for (double rate : absorption.ratesSince(absorbedAtLastReport, (now - currentTime) / 1000.0)) {
+                rates << " " << rate;
+            }
+            std::cout << "Absorptions/s per orbit:" << rates.str() << std::endl;
+            if (governor) {
+                const QualityLevels& levels = governor->levels(); // NIVELES ACTUALES
+                std::cout << "Quality: particles " << levels.particles << ", trail " << levels.trailLength
+                          << ", threads " << levels.threads << ", frame " << governor->averageMs() << " ms of "
+                          << FRAME_BUDGET << " (last: " << governor->lastDecision() << ")" << std::endl;
+            }
+            if (fixedStep) {
+                double seconds = (now - currentTime) / 1000.0; // SEGUNDOS DESDE EL ULTIMO REPORTE
+                std::cout << "Simulation steps/s: " << (timestep.steps() - stepsAtLastReport) / seconds
+                          << " (dropped " << timestep.dropped() - droppedAtLastReport << ")" << std::endl;
+                stepsAtLastReport = timestep.steps();
+                droppedAtLastReport = timestep.dropped();
+            }
+            currentTime = now; // ACTUALIZAR TIEMPO ACTUAL
+            frameCount = 0; // REINICIAR CONTADOR DE FRAMES
+        }
+    }
+
+    if (pipeline) {
+        pipeline->stop(); // DETENER EL HILO DE SIMULACION
+    }
+
+    // UNA FOTO QUE NO SE LLEGO A TOMAR TAMBIEN ES UNA FALLA
+    for (int frame : bench.snapshotFrames) {
+        if (static_cast<uint64_t>(frame) > frameNumber) {
+            logStream << "Snapshot frame " << frame << ": no se llego a este frame" << std::endl;
+            goldenFailures++;
+        }
+    }
+
+    // ESCRIBIR LA TRAZA (LOS HILOS DEL BACKEND YA NO ESTAN TRABAJANDO)
+    if (!TRACE_FILE.empty()) {
+        traceWrite(TRACE_FILE);
+    }
+
+    // ESCRIBIR EL REPORTE DEL BENCHMARK
+    if (bench.enabled) {
+        const bool openmp = BACKEND == BACKEND_OPENMP; // EL REPARTO SOLO APLICA A OPENMP
+        BenchInfo info{backendName(BACKEND), backendWorkers(), SEED, INITIAL_PARTICLES, motionKernelName(),
+                       openmp ? scheduleName(UPDATE_SCHEDULE) : "none", openmp ? SCHEDULE_CHUNK : 0, bench.render, {}};
+        for (int o = 0; o < absorption.orbitCount(); ++o) {
+            info.absorptions.push_back(absorption.total(o) - absorbedAtWarmup[o]); // SOLO LOS FRAMES MEDIDOS
+        }
+        if (bench.output.empty()) {
+            recorder.write(std::cout, bench.format, info);
+        } else {
+            std::ofstream file(bench.output); // ARCHIVO DEL REPORTE
+            if (!file) {
+                cerr << "No se pudo abrir " << bench.output << "\n";
+                return 1;
+            }
+            recorder.write(file, bench.format, info);
+        }
+    }
+
+    orbitBackground.destroy(); // DESTRUIR TEXTURA DEL FONDO
+    if (frameTexture != nullptr) {
+        SDL_DestroyTexture(frameTexture); // DESTRUIR TEXTURA
+    }
+    if (!bench.enabled) {
+        SDL_DestroyRenderer(renderer); // DESTRUIR RENDERIZADOR
+        SDL_DestroyWindow(window); // DESTRUIR VENTANA
+        SDL_Quit();
+    }
+
+    return goldenFailures == 0 ? 0 : 1; // FALLA SI ALGUNA FOTO NO COINCIDE
+}
@@ -0,0 +1,326 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "motion_kernel.h" // Include motion kernel header
+#include <cmath> // Include cmath header
+#include <algorithm> // Include algorithm header
+#include <cstring> // Include cstring header
+#include "fast_math.h" // Include fast math header
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h> // Include x86 intrinsics header
+#define MOTION_KERNEL_X86 1
+#endif
+
+namespace {
+
+constexpr float TWO_PI = 6.28318530717958647692f; // 2 * PI
+
+// FUNCION PARA MOVER UNA SOLA PARTICULA. ES LA VERSION ESCALAR DEL KERNEL Y
+// TAMBIEN TERMINA LAS PARTICULAS QUE SOBRAN AL FINAL DE CADA BLOQUE SIMD
+inline void moveParticle(ParticleSystem& ps, size_t i, const OrbitCenters& c, const MotionParams& p) {
+    if (ps.state[i] == PARTICLE_ORBITING) {
+        // ACTUALIZAR ANGULO
+        float angle = ps.angle[i] + p.orbitSpeed; // VELOCIDAD DE ORBITA
+        if (angle > TWO_PI) angle -= TWO_PI; // ANGULO DE ORBITA
+        ps.angle[i] = angle;
+
+        // COSENO Y SENO DEL ANGULO
+        float cosine, sine;
+        if (p.mode == ORBIT_MOTION_ROTATION) {
+            fastmath::rotate(ps.orbitCos[i], ps.orbitSin[i], p.cosStep, p.sinStep);
+            cosine = ps.orbitCos[i];
+            sine = ps.orbitSin[i];
+        } else if (p.mode == ORBIT_MOTION_POLY) {
+            fastmath::sincos(angle, sine, cosine);
+        } else {
+            cosine = std::cos(angle);
+            sine = std::sin(angle);
+        }
+
+        size_t o = static_cast<size_t>(ps.orbitIndex[i]); // INDICE DEL CENTRO
+        float r = ps.orbitRadius[i]; // RADIO DE ORBITA
+        ps.x[i] = c.x[o] + r * cosine; // COORDENADA X
+        ps.y[i] = c.y[o] + r * sine; // COORDENADA Y
+
+        // CHEQUEAR RADIO DE ABSORCION Y REDUCIR RADIO DE ORBITA
+        if (r < p.absorptionRadius) {
+            ps.state[i] = PARTICLE_DEAD; // PARTICULA MUERE
+        } else {
+            ps.orbitRadius[i] = std::max(r - p.radiusDecay, 0.0f);
+        }
+    } else if (ps.state[i] == PARTICLE_ROAMING) {
+        // MOVER PARTICULA
+        ps.x[i] += ps.dx[i];
+        ps.y[i] += ps.dy[i];
+
+        // REBOTAR EN LOS BORDES
+        if (ps.x[i] < 0 || ps.x[i] >= p.width) ps.dx[i] = -ps.dx[i];
+        if (ps.y[i] < 0 || ps.y[i] >= p.height) ps.dy[i] = -ps.dy[i];
+    }
+}
+
+// KERNEL ESCALAR
+void motionScalar(ParticleSystem& ps, size_t begin, size_t end, const OrbitCenters& c, const MotionParams& p) {
+    for (size_t i = begin; i < end; ++i) {
+        moveParticle(ps, i, c, p);
+    }
+}
+
+#ifdef MOTION_KERNEL_X86
+
+// KERNEL AVX2: 8 PARTICULAS POR ITERACION. AMBOS CAMINOS (ORBITA Y LIBRE) SE
+// CALCULAN PARA TODAS Y SE MEZCLAN CON MASCARAS SEGUN EL ESTADO
+__attribute__((target("avx2")))
+void motionAvx2(ParticleSystem& ps, size_t begin, size_t end, const OrbitCenters& c, const MotionParams& p) {
+    const __m256 speed = _mm256_set1_ps(p.orbitSpeed);
+    const __m256 twoPi = _mm256_set1_ps(TWO_PI);
+    const __m256 absorption = _mm256_set1_ps(p.absorptionRadius);
+    const __m256 decay = _mm256_set1_ps(p.radiusDecay);
+    const __m256 width = _mm256_set1_ps(p.width);
+    const __m256 height = _mm256_set1_ps(p.height);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    const __m256i orbiting = _mm256_set1_epi32(PARTICLE_ORBITING);
+    const __m256i roaming = _mm256_set1_epi32(PARTICLE_ROAMING);
+    const __m256 cosStep = _mm256_set1_ps(p.cosStep);
+    const __m256 sinStep = _mm256_set1_ps(p.sinStep);
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8) {
+        // MASCARAS DE ESTADO
+        __m256i state = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&ps.state[i])));
+        __m256 isOrbiting = _mm256_castsi256_ps(_mm256_cmpeq_epi32(state, orbiting));
+        __m256 isRoaming = _mm256_castsi256_ps(_mm256_cmpeq_epi32(state, roaming));
+
+        __m256 x = _mm256_loadu_ps(&ps.x[i]);
+        __m256 y = _mm256_loadu_ps(&ps.y[i]);
+        __m256 dx = _mm256_loadu_ps(&ps.dx[i]);
+        __m256 dy = _mm256_loadu_ps(&ps.dy[i]);
+        __m256 angle = _mm256_loadu_ps(&ps.angle[i]);
+        __m256 r = _mm256_loadu_ps(&ps.orbitRadius[i]);
+
+        // ORBITA: AVANZAR Y ACOTAR EL ANGULO
+        __m256 newAngle = _mm256_add_ps(angle, speed);
+        newAngle = _mm256_sub_ps(newAngle, _mm256_and_ps(_mm256_cmp_ps(newAngle, twoPi, _CMP_GT_OQ), twoPi));
+
+        // ORBITA: CENTROS (SOLO SE LEEN LOS DE LAS QUE ORBITAN)
+        __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&ps.orbitIndex[i]));
+        __m256 cx = _mm256_mask_i32gather_ps(zero, c.x, index, isOrbiting, 4);
+        __m256 cy = _mm256_mask_i32gather_ps(zero, c.y, index, isOrbiting, 4);
+
+        // ORBITA: SENO Y COSENO
+        __m256 cosine, sine;
+        if (p.mode == ORBIT_MOTION_ROTATION) {
+            __m256 oldCos = _mm256_loadu_ps(&ps.orbitCos[i]);
+            __m256 oldSin = _mm256_loadu_ps(&ps.orbitSin[i]);
+            cosine = _mm256_sub_ps(_mm256_mul_ps(oldCos, cosStep), _mm256_mul_ps(oldSin, sinStep));
+            sine = _mm256_add_ps(_mm256_mul_ps(oldSin, cosStep), _mm256_mul_ps(oldCos, sinStep));
+            __m256 norm = _mm256_add_ps(_mm256_mul_ps(cosine, cosine), _mm256_mul_ps(sine, sine));
+            __m256 k = _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(_mm256_set1_ps(0.5f), norm));
+            cosine = _mm256_mul_ps(cosine, k);
+            sine = _mm256_mul_ps(sine, k);
+            _mm256_storeu_ps(&ps.orbitCos[i], _mm256_blendv_ps(oldCos, cosine, isOrbiting));
+            _mm256_storeu_ps(&ps.orbitSin[i], _mm256_blendv_ps(oldSin, sine, isOrbiting));
+        } else if (p.mode == ORBIT_MOTION_POLY) {
+            fastmath::sincos8(newAngle, sine, cosine);
+        } else {
+            alignas(32) float angles[8], cosines[8], sines[8];
+            _mm256_store_ps(angles, newAngle);
+            for (int k = 0; k < 8; ++k) {
+                cosines[k] = std::cos(angles[k]);
+                sines[k] = std::sin(angles[k]);
+            }
+            cosine = _mm256_load_ps(cosines);
+            sine = _mm256_load_ps(sines);
+        }
+        __m256 orbitX = _mm256_add_ps(cx, _mm256_mul_ps(r, cosine));
+        __m256 orbitY = _mm256_add_ps(cy, _mm256_mul_ps(r, sine));
+
+        // ORBITA: ABSORCION Y REDUCCION DEL RADIO
+        __m256 absorbed = _mm256_and_ps(isOrbiting, _mm256_cmp_ps(r, absorption, _CMP_LT_OQ));
+        __m256 decayed = _mm256_max_ps(_mm256_sub_ps(r, decay), zero);
+
+        // LIBRE: MOVER Y REBOTAR EN LOS BORDES
+        __m256 roamX = _mm256_add_ps(x, dx);
+        __m256 roamY = _mm256_add_ps(y, dy);
+        __m256 bounceX = _mm256_or_ps(_mm256_cmp_ps(roamX, zero, _CMP_LT_OQ), _mm256_cmp_ps(roamX, width, _CMP_GE_OQ));
+        __m256 bounceY = _mm256_or_ps(_mm256_cmp_ps(roamY, zero, _CMP_LT_OQ), _mm256_cmp_ps(roamY, height, _CMP_GE_OQ));
+        dx = _mm256_xor_ps(dx, _mm256_and_ps(_mm256_and_ps(bounceX, isRoaming), signBit));
+        dy = _mm256_xor_ps(dy, _mm256_and_ps(_mm256_and_ps(bounceY, isRoaming), signBit));
+
+        // MEZCLAR SEGUN EL ESTADO
+        x = _mm256_blendv_ps(_mm256_blendv_ps(x, roamX, isRoaming), orbitX, isOrbiting);
+        y = _mm256_blendv_ps(_mm256_blendv_ps(y, roamY, isRoaming), orbitY, isOrbiting);
+        angle = _mm256_blendv_ps(angle, newAngle, isOrbiting);
+        r = _mm256_blendv_ps(r, decayed, _mm256_andnot_ps(absorbed, isOrbiting));
+
+        _mm256_storeu_ps(&ps.x[i], x);
+        _mm256_storeu_ps(&ps.y[i], y);
+        _mm256_storeu_ps(&ps.dx[i], dx);
+        _mm256_storeu_ps(&ps.dy[i], dy);
+        _mm256_storeu_ps(&ps.angle[i], angle);
+        _mm256_storeu_ps(&ps.orbitRadius[i], r);
+
+        // MARCAR LAS ABSORBIDAS
+        for (int dead = _mm256_movemask_ps(absorbed); dead != 0; dead &= dead - 1) {
+            ps.state[i + __builtin_ctz(dead)] = PARTICLE_DEAD;
+        }
+    }
+
+    // PARTICULAS SOBRANTES
+    for (; i < end; ++i) {
+        moveParticle(ps, i, c, p);
+    }
+}
+
+// KERNEL SSE4.1: 4 PARTICULAS POR ITERACION, MISMA LOGICA QUE EL AVX2 PERO
+// SIN GATHER (LOS CENTROS SE LEEN UNO POR UNO)
+__attribute__((target("sse4.1")))
+void motionSse41(ParticleSystem& ps, size_t begin, size_t end, const OrbitCenters& c, const MotionParams& p) {
+    const __m128 speed = _mm_set1_ps(p.orbitSpeed);
+    const __m128 twoPi = _mm_set1_ps(TWO_PI);
+    const __m128 absorption = _mm_set1_ps(p.absorptionRadius);
+    const __m128 decay = _mm_set1_ps(p.radiusDecay);
+    const __m128 width = _mm_set1_ps(p.width);
+    const __m128 height = _mm_set1_ps(p.height);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128i orbiting = _mm_set1_epi32(PARTICLE_ORBITING);
+    const __m128i roaming = _mm_set1_epi32(PARTICLE_ROAMING);
+    const __m128 cosStep = _mm_set1_ps(p.cosStep);
+    const __m128 sinStep = _mm_set1_ps(p.sinStep);
+
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4) {
+        // MASCARAS DE ESTADO
+        int packed;
+        std::memcpy(&packed, &ps.state[i], sizeof(packed));
+        __m128i state = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed));
+        __m128 isOrbiting = _mm_castsi128_ps(_mm_cmpeq_epi32(state, orbiting));
+        __m128 isRoaming = _mm_castsi128_ps(_mm_cmpeq_epi32(state, roaming));
+
+        __m128 x = _mm_loadu_ps(&ps.x[i]);
+        __m128 y = _mm_loadu_ps(&ps.y[i]);
+        __m128 dx = _mm_loadu_ps(&ps.dx[i]);
+        __m128 dy = _mm_loadu_ps(&ps.dy[i]);
+        __m128 angle = _mm_loadu_ps(&ps.angle[i]);
+        __m128 r = _mm_loadu_ps(&ps.orbitRadius[i]);
+
+        // ORBITA: AVANZAR Y ACOTAR EL ANGULO
+        __m128 newAngle = _mm_add_ps(angle, speed);
+        newAngle = _mm_sub_ps(newAngle, _mm_and_ps(_mm_cmpgt_ps(newAngle, twoPi), twoPi));
+
+        // ORBITA: CENTROS (SOLO SE LEEN LOS DE LAS QUE ORBITAN)
+        alignas(16) float centerX[4], centerY[4];
+        for (int k = 0; k < 4; ++k) {
+            bool inOrbit = ps.state[i + k] == PARTICLE_ORBITING;
+            size_t o = inOrbit ? static_cast<size_t>(ps.orbitIndex[i + k]) : 0;
+            centerX[k] = inOrbit ? c.x[o] : 0.0f;
+            centerY[k] = inOrbit ? c.y[o] : 0.0f;
+        }
+
+        // ORBITA: SENO Y COSENO
+        __m128 cosine, sine;
+        if (p.mode == ORBIT_MOTION_ROTATION) {
+            __m128 oldCos = _mm_loadu_ps(&ps.orbitCos[i]);
+            __m128 oldSin = _mm_loadu_ps(&ps.orbitSin[i]);
+            cosine = _mm_sub_ps(_mm_mul_ps(oldCos, cosStep), _mm_mul_ps(oldSin, sinStep));
+            sine = _mm_add_ps(_mm_mul_ps(oldSin, cosStep), _mm_mul_ps(oldCos, sinStep));
+            __m128 norm = _mm_add_ps(_mm_mul_ps(cosine, cosine), _mm_mul_ps(sine, sine));
+            __m128 k = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_set1_ps(0.5f), norm));
+            cosine = _mm_mul_ps(cosine, k);
+            sine = _mm_mul_ps(sine, k);
+            _mm_storeu_ps(&ps.orbitCos[i], _mm_blendv_ps(oldCos, cosine, isOrbiting));
+            _mm_storeu_ps(&ps.orbitSin[i], _mm_blendv_ps(oldSin, sine, isOrbiting));
+        } else if (p.mode == ORBIT_MOTION_POLY) {
+            fastmath::sincos4(newAngle, sine, cosine);
+        } else {
+            alignas(16) float angles[4], cosines[4], sines[4];
+            _mm_store_ps(angles, newAngle);
+            for (int k = 0; k < 4; ++k) {
+                cosines[k] = std::cos(angles[k]);
+                sines[k] = std::sin(angles[k]);
+            }
+            cosine = _mm_load_ps(cosines);
+            sine = _mm_load_ps(sines);
+        }
+        __m128 orbitX = _mm_add_ps(_mm_load_ps(centerX), _mm_mul_ps(r, cosine));
+        __m128 orbitY = _mm_add_ps(_mm_load_ps(centerY), _mm_mul_ps(r, sine));
+
+        // ORBITA: ABSORCION Y REDUCCION DEL RADIO
+        __m128 absorbed = _mm_and_ps(isOrbiting, _mm_cmplt_ps(r, absorption));
+        __m128 decayed = _mm_max_ps(_mm_sub_ps(r, decay), zero);
+
+        // LIBRE: MOVER Y REBOTAR EN LOS BORDES
+        __m128 roamX = _mm_add_ps(x, dx);
+        __m128 roamY = _mm_add_ps(y, dy);
+        __m128 bounceX = _mm_or_ps(_mm_cmplt_ps(roamX, zero), _mm_cmpge_ps(roamX, width));
+        __m128 bounceY = _mm_or_ps(_mm_cmplt_ps(roamY, zero), _mm_cmpge_ps(roamY, height));
+        dx = _mm_xor_ps(dx, _mm_and_ps(_mm_and_ps(bounceX, isRoaming), signBit));
+        dy = _mm_xor_ps(dy, _mm_and_ps(_mm_and_ps(bounceY, isRoaming), signBit));
+
+        // MEZCLAR SEGUN EL ESTADO
+        x = _mm_blendv_ps(_mm_blendv_ps(x, roamX, isRoaming), orbitX, isOrbiting);
+        y = _mm_blendv_ps(_mm_blendv_ps(y, roamY, isRoaming), orbitY, isOrbiting);
+        angle = _mm_blendv_ps(angle, newAngle, isOrbiting);
+        r = _mm_blendv_ps(r, decayed, _mm_andnot_ps(absorbed, isOrbiting));
+
+        _mm_storeu_ps(&ps.x[i], x);
+        _mm_storeu_ps(&ps.y[i], y);
+        _mm_storeu_ps(&ps.dx[i], dx);
+        _mm_storeu_ps(&ps.dy[i], dy);
+        _mm_storeu_ps(&ps.angle[i], angle);
+        _mm_storeu_ps(&ps.orbitRadius[i], r);
+
+        // MARCAR LAS ABSORBIDAS
+        for (int dead = _mm_movemask_ps(absorbed); dead != 0; dead &= dead - 1) {
+            ps.state[i + __builtin_ctz(dead)] = PARTICLE_DEAD;
+        }
+    }
+
+    // PARTICULAS SOBRANTES
+    for (; i < end; ++i) {
+        moveParticle(ps, i, c, p);
+    }
+}
+
+#endif // MOTION_KERNEL_X86
+
+// KERNEL DISPONIBLE
+struct MotionKernel {
+    void (*run)(ParticleSystem&, size_t, size_t, const OrbitCenters&, const MotionParams&); // FUNCION
+    const char* name; // NOMBRE
+};
+
+// FUNCION PARA ESCOGER EL MEJOR KERNEL QUE SOPORTE EL PROCESADOR
+MotionKernel selectMotionKernel() {
+#ifdef MOTION_KERNEL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return {motionAvx2, "avx2"};
+    if (__builtin_cpu_supports("sse4.1")) return {motionSse41, "sse4.1"};
+#endif
+    return {motionScalar, "scalar"};
+}
+
+// KERNEL ESCOGIDO, SE DETECTA UNA SOLA VEZ
+const MotionKernel& motionKernel() {
+    static const MotionKernel kernel = selectMotionKernel();
+    return kernel;
+}
+
+} // namespace
+
+void integrateMotion(ParticleSystem& ps, size_t begin, size_t end, const OrbitCenters& centers,
+                     const MotionParams& params) {
+    motionKernel().run(ps, begin, end, centers, params);
+}
+
+const char* motionKernelName() {
+    return motionKernel().name;
+}
@@ -0,0 +1,355 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "options.h" // Include options header
+#include <cmath> // Include cmath header
+#include <cstdint> // Include cstdint header
+#include <fstream> // Include fstream header
+#include <iostream> // Include iostream header
+#include <random> // Include random header
+#include <string> // Include string header
+#include <utility> // Include utility header
+#include <vector> // Include vector header
+#include "motion_kernel.h" // Include motion kernel header
+#include "execution_backend.h" // Include execution backend header
+#include "settings.h" // Include settings header
+
+namespace {
+
+// PUNTOS DE ESTELA MAXIMOS (particulas x longitud de la cola)
+constexpr int64_t MAX_TRAIL_POINTS = 100000000;
+
+// FUNCION PARA LEER UN ENTERO EN [low, high]
+bool parseInt(const std::string& text, int low, int high, int& value) {
+    try {
+        size_t used = 0; // CARACTERES LEIDOS
+        long parsed = std::stol(text, &used);
+        if (used != text.size() || parsed < low || parsed > high) return false;
+        value = static_cast<int>(parsed);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+// FUNCION PARA LEER UN NUMERO REAL FINITO EN [low, high]
+bool parseFloat(const std::string& text, float low, float high, float& value) {
+    try {
+        size_t used = 0; // CARACTERES LEIDOS
+        float parsed = std::stof(text, &used);
+        if (used != text.size() || !std::isfinite(parsed) || parsed < low || parsed > high) return false;
+        value = parsed;
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+// FUNCION PARA LEER UNA LISTA "a,b,c" DE ENTEROS EN [low, high]
+bool parseIntList(const std::string& text, int low, int high, std::vector<int>& values) {
+    values.clear();
+    size_t begin = 0; // INICIO DEL ELEMENTO ACTUAL
+    while (true) {
+        size_t comma = text.find(',', begin); // FIN DEL ELEMENTO
+        int value; // ELEMENTO
+        if (!parseInt(text.substr(begin, comma - begin), low, high, value)) return false;
+        values.push_back(value);
+        if (comma == std::string::npos) return true;
+        begin = comma + 1;
+    }
+}
+
+// FUNCION PARA LEER UNA SEMILLA DE 64 BITS
+bool parseSeed(const std::string& text, uint64_t& value) {
+    try {
+        size_t used = 0; // CARACTERES LEIDOS
+        if (text.empty() || text[0] == '-') return false;
+        uint64_t parsed = std::stoull(text, &used);
+        if (used != text.size()) return false;
+        value = parsed;
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+// FUNCION PARA QUITAR ESPACIOS AL INICIO Y AL FINAL
+std::string trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos) return "";
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+// FUNCION PARA SABER SI UNA OPCION NO RECIBE VALOR
+bool isSwitch(const std::string& key) {
+    return key == "bench";
+}
+
+// FUNCION PARA APLICAR UNA OPCION; DEVUELVE EL MENSAJE DE ERROR O "" SI ES VALIDA
+std::string applyOption(const std::string& key, const std::string& value, BenchOptions& bench, bool& seedGiven) {
+    if (key == "width") {
+        if (!parseInt(value, 1, 16384, SCREEN_WIDTH)) return "el ancho debe ser un entero entre 1 y 16384";
+    } else if (key == "height") {
+        if (!parseInt(value, 1, 16384, SCREEN_HEIGHT)) return "el alto debe ser un entero entre 1 y 16384";
+    } else if (key == "particles") {
+        if (!parseInt(value, 1, 100000000, INITIAL_PARTICLES)) return "la cantidad de particulas debe ser un entero positivo";
+    } else if (key == "trail-length") {
+        if (!parseInt(value, 1, 1024, TRAIL_LENGTH)) return "la longitud de la cola debe ser un entero entre 1 y 1024";
+    } else if (key == "orbits") {
+        if (!parseInt(value, 1, 10000, NUM_ORBITS)) return "la cantidad de orbitas debe ser un entero entre 1 y 10000";
+    } else if (key == "orbit-speed") {
+        if (!parseFloat(value, 0, 3.14159f, ORBIT_SPEED)) return "la velocidad de la orbita debe estar entre 0 y pi";
+    } else if (key == "roam-speed") {
+        if (!parseFloat(value, 0, 1000, ROAM_SPEED)) return "la velocidad de los destellos debe estar entre 0 y 1000";
+    } else if (key == "capture-radius") {
+        if (!parseFloat(value, 0, 100000, CAPTURE_RADIUS)) return "el radio de atrapamiento debe ser un numero no negativo";
+    } else if (key == "absorption-radius") {
+        if (!parseFloat(value, 0, 100000, ABSORPTION_RADIUS)) return "el radio de absorcion debe ser un numero no negativo";
+    } else if (key == "escape-probability") {
+        if (!parseFloat(value, 0, 1, ESCAPE_PROBABILITY)) return "la posibilidad de escape debe estar entre 0 y 1";
+    } else if (key == "capture-probability") {
+        if (!parseFloat(value, 0, 1, CAPTURE_PROBABILITY)) return "la posibilidad de absorcion debe estar entre 0 y 1";
+    } else if (key == "backend") {
+        int backend; // BACKEND PEDIDO
+        if (value == "sequential") backend = BACKEND_SEQUENTIAL;
+        else if (value == "openmp") backend = BACKEND_OPENMP;
+        else if (value == "std") backend = BACKEND_STD;
+        else if (value == "tasks") backend = BACKEND_TASKS;
+        else return "backend invalido, use sequential, openmp, std o tasks";
+        if (!backendAvailable(backend)) return "este programa se compilo sin ese backend";
+        BACKEND = backend;
+    } else if (key == "threads") {
+        if (!parseInt(value, 0, 1024, NUM_THREADS)) return "la cantidad de hilos debe ser un entero entre 0 y 1024";
+    } else if (key == "schedule") {
+        if (value == "static") UPDATE_SCHEDULE = SCHEDULE_STATIC;
+        else if (value == "dynamic") UPDATE_SCHEDULE = SCHEDULE_DYNAMIC;
+        else if (value == "guided") UPDATE_SCHEDULE = SCHEDULE_GUIDED;
+        else return "use static, dynamic o guided";
+    } else if (key == "chunk") {
+        if (!parseInt(value, 0, 1 << 20, SCHEDULE_CHUNK)) return "el tamano del pedazo debe ser un entero entre 0 y 1048576";
+    } else if (key == "pipeline") {
+        if (value == "on") PIPELINE = true;
+        else if (value == "off") PIPELINE = false;
+        else return "use on u off";
+    } else if (key == "sim-rate") {
+        if (!parseFloat(value, 0, 10000, SIM_RATE)) return "los pasos por segundo deben estar entre 0 y 10000";
+    } else if (key == "max-substeps") {
+        if (!parseInt(value, 1, 1000, MAX_SUBSTEPS)) return "los pasos por frame deben ser un entero entre 1 y 1000";
+    } else if (key == "frame-budget") {
+        if (!parseFloat(value, 0, 10000, FRAME_BUDGET)) return "el presupuesto debe estar entre 0 y 10000 ms";
+    } else if (key == "trace") {
+        if (value.empty()) return "falta el nombre del archivo";
+        TRACE_FILE = value;
+    } else if (key == "seed") {
+        if (!parseSeed(value, SEED)) return "la semilla debe ser un entero no negativo";
+        seedGiven = true;
+    } else if (key == "render") {
+        if (value == "sdl") RENDER_MODE = RENDER_SDL;
+        else if (value == "software") RENDER_MODE = RENDER_SOFTWARE;
+        else if (value == "points") RENDER_MODE = RENDER_POINTS;
+        else if (value == "geometry") RENDER_MODE = RENDER_GEOMETRY;
+        else return "modo de dibujo invalido, use sdl, software, points o geometry";
+    } else if (key == "orbit-motion") {
+        if (value == "libm") ORBIT_MOTION = ORBIT_MOTION_LIBM;
+        else if (value == "poly") ORBIT_MOTION = ORBIT_MOTION_POLY;
+        else if (value == "rotation") ORBIT_MOTION = ORBIT_MOTION_ROTATION;
+        else return "modo de orbita invalido, use libm, poly o rotation";
+    } else if (key == "bench") {
+        bench.enabled = true;
+    } else if (key == "bench-frames") {
+        if (!parseInt(value, 1, 100000000, bench.frames)) return "la cantidad de frames debe ser un entero positivo";
+    } else if (key == "bench-warmup") {
+        if (!parseInt(value, 0, 100000000, bench.warmup)) return "la cantidad de frames debe ser un entero no negativo";
+    } else if (key == "bench-render") {
+        if (value == "software") bench.render = true;
+        else if (value == "none") bench.render = false;
+        else return "modo de dibujo del benchmark invalido, use software o none";
+    } else if (key == "bench-format") {
+        if (value == "json") bench.format = BENCH_JSON;
+        else if (value == "csv") bench.format = BENCH_CSV;
+        else return "formato invalido, use json o csv";
+    } else if (key == "bench-output") {
+        bench.output = value;
+    } else if (key == "snapshot-frames") {
+        if (!parseIntList(value, 1, 100000000, bench.snapshotFrames)) return "use una lista de frames positivos separados por comas";
+    } else if (key == "snapshot-dir") {
+        if (value.empty()) return "falta el nombre de la carpeta";
+        bench.snapshotDir = value;
+    } else if (key == "golden") {
+        if (value.empty()) return "falta el nombre de la carpeta";
+        bench.goldenDir = value;
+    } else if (key == "golden-tolerance") {
+        if (!parseFloat(value, 0, 100000, bench.goldenPosition)) return "la tolerancia debe ser un numero no negativo";
+    } else if (key == "golden-channel") {
+        if (!parseInt(value, 0, 255, bench.goldenChannel)) return "la tolerancia de color debe ser un entero entre 0 y 255";
+    } else if (key == "golden-max-diff") {
+        if (!parseFloat(value, 0, 1, bench.goldenMaxDiff)) return "la fraccion debe estar entre 0 y 1";
+    } else {
+        return "opcion desconocida";
+    }
+    return "";
+}
+
+// FUNCION PARA LEER EL ARCHIVO DE CONFIGURACION
+bool readConfig(const std::string& path, std::vector<std::pair<std::string, std::string>>& entries) {
+    std::ifstream file(path); // ARCHIVO DE CONFIGURACION
+    if (!file) {
+        std::cerr << "No se pudo abrir el archivo de configuracion " << path << "\n";
+        return false;
+    }
+    std::string line; // LINEA ACTUAL
+    for (int number = 1; std::getline(file, line); ++number) {
+        line = trim(line);
+        if (line.empty() || line[0] == '#') continue;
+        size_t equals = line.find('='); // SEPARADOR ENTRE CLAVE Y VALOR
+        std::string key = trim(line.substr(0, equals));
+        std::string value = equals == std::string::npos ? "" : trim(line.substr(equals + 1));
+        if (equals == std::string::npos && !isSwitch(key)) {
+            std::cerr << path << ":" << number << ": se esperaba clave = valor\n";
+            return false;
+        }
+        entries.emplace_back(key, value);
+    }
+    return true;
+}
+
+} // namespace
+
+// FUNCION PARA LEER LAS OPCIONES Y LLENAR LOS PARAMETROS GLOBALES
+OptionsResult parseOptions(int argc, char* argv[], BenchOptions& bench) {
+    std::vector<std::pair<std::string, std::string>> fileEntries; // OPCIONES DEL ARCHIVO
+    std::vector<std::pair<std::string, std::string>> flagEntries; // OPCIONES DE LA LINEA DE COMANDOS
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i]; // ARGUMENTO ACTUAL
+        if (arg == "--help" || arg == "-h") {
+            printUsage(argv[0]);
+            return OPTIONS_HELP;
+        }
+        if (arg.rfind("--", 0) != 0) {
+            std::cerr << "Argumento invalido: " << arg << "\n";
+            return OPTIONS_ERROR;
+        }
+        std::string key = arg.substr(2); // NOMBRE DE LA OPCION
+        std::string value; // VALOR DE LA OPCION
+        size_t equals = key.find('='); // TAMBIEN SE ACEPTA --clave=valor
+        if (equals != std::string::npos) {
+            value = key.substr(equals + 1);
+            key = key.substr(0, equals);
+        } else if (!isSwitch(key)) {
+            if (i + 1 >= argc) {
+                std::cerr << "Falta el valor de --" << key << "\n";
+                return OPTIONS_ERROR;
+            }
+            value = argv[++i];
+        }
+
+        if (key == "config") {
+            if (!readConfig(value, fileEntries)) return OPTIONS_ERROR;
+        } else {
+            flagEntries.emplace_back(key, value);
+        }
+    }
+
+    bool seedGiven = false; // SE RECIBIO UNA SEMILLA
+    for (const auto* entries : {&fileEntries, &flagEntries}) {
+        for (const auto& [key, value] : *entries) {
+            std::string error = applyOption(key, value, bench, seedGiven);
+            if (!error.empty()) {
+                std::cerr << "--" << key << " " << value << ": " << error << "\n";
+                return OPTIONS_ERROR;
+            }
+        }
+    }
+
+    // LAS ESTELAS SE RESERVAN AL INICIO (particulas x longitud PUNTOS DE 8 BYTES,
+    // Y OTRAS TRES COPIAS CON --pipeline), ASI QUE SE LIMITA EL PRODUCTO
+    const int64_t trailPoints = static_cast<int64_t>(INITIAL_PARTICLES) * TRAIL_LENGTH; // PUNTOS DE ESTELA
+    if (trailPoints > MAX_TRAIL_POINTS) {
+        std::cerr << "--particles " << INITIAL_PARTICLES << " x --trail-length " << TRAIL_LENGTH << " = " << trailPoints
+                  << " puntos de estela; el maximo es " << MAX_TRAIL_POINTS << " (" << MAX_TRAIL_POINTS * 8 / 1000000
+                  << " MB)\n";
+        return OPTIONS_ERROR;
+    }
+
+    // LAS FOTOS SE TOMAN DEL FRAMEBUFFER EN MEMORIA DEL MODO BENCHMARK
+    const bool snapshots = !bench.snapshotDir.empty() || !bench.goldenDir.empty(); // SE PIDIERON FOTOS
+    if (snapshots != !bench.snapshotFrames.empty() || (snapshots && !bench.enabled)) {
+        std::cerr << "--snapshot-frames necesita --snapshot-dir o --golden, y los tres necesitan --bench\n";
+        return OPTIONS_ERROR;
+    }
+    // UN FRAME DESPUES DEL ULTIMO NUNCA SE TOMARIA NI SE COMPARARIA
+    const int lastFrame = bench.warmup + bench.frames; // ULTIMO FRAME DEL BENCHMARK
+    for (int frame : bench.snapshotFrames) {
+        if (frame > lastFrame) {
+            std::cerr << "--snapshot-frames " << frame << ": el benchmark solo corre " << lastFrame
+                      << " frames (--bench-warmup + --bench-frames)\n";
+            return OPTIONS_ERROR;
+        }
+    }
+
+    if (!seedGiven) {
+        std::random_device rd; // DISPOSITIVO ALEATORIO
+        SEED = (static_cast<uint64_t>(rd()) << 32) | rd(); // SEMILLA ALEATORIA
+    }
+    return OPTIONS_OK;
+}
+
+// FUNCION PARA MOSTRAR LA AYUDA
+void printUsage(const char* program) {
+    std::cout << "Uso: " << program << " [opciones]\n"
+              << "\n"
+              << "Simulacion (valor por defecto entre parentesis):\n"
+              << "  --width N                  ancho de la pantalla (800)\n"
+              << "  --height N                 alto de la pantalla (600)\n"
+              << "  --particles N              cantidad de particulas (5000)\n"
+              << "  --trail-length N           longitud de la cola (20)\n"
+              << "  --orbits N                 cantidad de orbitas (5)\n"
+              << "  --orbit-speed X            velocidad de la orbita (0.02)\n"
+              << "  --roam-speed X             velocidad de los destellos (1.0)\n"
+              << "  --capture-radius X         radio de atrapamiento (100)\n"
+              << "  --absorption-radius X      radio de absorcion (5)\n"
+              << "  --escape-probability X     posibilidad de escape (0.005)\n"
+              << "  --capture-probability X    posibilidad de absorcion (0.05)\n"
+              << "  --seed N                   semilla (aleatoria)\n"
+              << "\n"
+              << "Ejecucion:\n"
+              << "  --backend MODO             sequential, openmp, std o tasks (" << backendName(BACKEND) << ")\n"
+              << "  --threads N                hilos del backend, 0 usa el valor del sistema (0)\n"
+              << "  --schedule MODO            reparto del ciclo de actualizacion con OpenMP: static, dynamic o guided (static)\n"
+              << "  --chunk N                  bloques de 1024 particulas por pedazo del ciclo de actualizacion: el chunk\n"
+              << "                             de --schedule con openmp, o las particulas de cada tarea con tasks;\n"
+              << "                             0 usa el valor por defecto (0)\n"
+              << "  --pipeline on|off          simular y dibujar en hilos distintos (off)\n"
+              << "  --sim-rate HZ              pasos de simulacion por segundo, 0 da un paso por frame (60)\n"
+              << "  --max-substeps N           pasos maximos por frame, los demas se descartan (4)\n"
+              << "  --frame-budget MS          ajustar particulas, estela e hilos para no pasar de MS por frame, 0 lo apaga (0)\n"
+              << "  --render MODO              sdl, software, points o geometry (software)\n"
+              << "  --orbit-motion MODO        libm, poly o rotation (poly)\n"
+              << "  --config ARCHIVO           leer opciones de un archivo \"clave = valor\"\n"
+              << "\n"
+              << "Benchmark:\n"
+              << "  --bench                    correr sin ventana y escribir un reporte\n"
+              << "  --bench-frames N           frames a medir (1000)\n"
+              << "  --bench-warmup N           frames que se corren antes de medir (0)\n"
+              << "  --bench-render MODO        software o none (software)\n"
+              << "  --bench-format FORMATO     json o csv (json)\n"
+              << "  --bench-output ARCHIVO     archivo del reporte (salida estandar)\n"
+              << "\n"
+              << "Fotos y referencias (solo con --bench):\n"
+              << "  --snapshot-frames LISTA    frames en los que se toma una foto, separados por comas\n"
+              << "  --snapshot-dir CARPETA     guardar las fotos en la carpeta\n"
+              << "  --golden CARPETA           comparar las fotos contra las de la carpeta\n"
+              << "  --golden-tolerance X       diferencia maxima de posicion en pixeles (0.5)\n"
+              << "  --golden-channel N         diferencia maxima por canal de color (2)\n"
+              << "  --golden-max-diff F        fraccion de particulas o pixeles que pueden pasarse (0.001)\n"
+              << "\n"
+              << "Instrumentacion:\n"
+              << "  --trace ARCHIVO            escribir una traza de Chrome (chrome://tracing o Perfetto)\n";
+}
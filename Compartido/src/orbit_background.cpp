@@ -0,0 +1,76 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "orbit_background.h" // Include orbit background header
+#include <algorithm> // Include algorithm header
+#include <cstring> // Include cstring header
+#include <iostream> // Include iostream header
+#include "execution_backend.h" // Include execution backend header
+
+// FUNCION PARA RASTERIZAR EL FONDO Y CREAR SU TEXTURA
+void OrbitBackground::build(SDL_Renderer* renderer, const OrbitGeometry& orbits, int width, int height) {
+    this->width = width;
+    this->height = height;
+    pixels.assign(static_cast<size_t>(width) * height, 0);
+
+    FrameBuffer fb{pixels.data(), width, height, width};
+    clearFrame(fb, packColor(0, 0, 0)); // FONDO NEGRO
+    rasterizeOrbits(fb, orbits); // ANILLOS DE LAS ORBITAS
+    buildOrbitRings(orbits, ringPoints);
+
+    reloadTexture(renderer);
+}
+
+// FUNCION PARA VOLVER A SUBIR LA TEXTURA (SDL_RENDER_DEVICE_RESET LA INVALIDA)
+void OrbitBackground::reloadTexture(SDL_Renderer* renderer) {
+    destroy();
+    if (renderer == nullptr) return;
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, width, height);
+    if (texture == nullptr || SDL_UpdateTexture(texture, nullptr, pixels.data(), width * 4) != 0) {
+        // SIN TEXTURA SE DIBUJAN LOS ANILLOS PUNTO POR PUNTO EN CADA FRAME
+        std::cerr << "No se pudo crear la textura del fondo: " << SDL_GetError() << "\n";
+        destroy();
+    }
+}
+
+// FUNCION PARA COPIAR EL FONDO AL FRAMEBUFFER DEL RASTERIZADOR POR SOFTWARE
+void OrbitBackground::copyTo(const FrameBuffer& fb) const {
+    parallelFor(height, [&](size_t y, int) { // CADA TRABAJADOR COPIA UN GRUPO DE FILAS
+        copyRows(fb, static_cast<int>(y), static_cast<int>(y) + 1);
+    });
+}
+
+// FUNCION PARA COPIAR SOLO ALGUNAS FILAS DEL FONDO
+void OrbitBackground::copyRows(const FrameBuffer& fb, int first, int last) const {
+    const size_t rowBytes = static_cast<size_t>(width) * sizeof(Uint32); // BYTES POR FILA
+    for (int y = std::max(first, 0); y < std::min(last, height); ++y) {
+        std::memcpy(fb.pixels + static_cast<size_t>(y) * fb.pitch, pixels.data() + static_cast<size_t>(y) * width, rowBytes);
+    }
+}
+
+// FUNCION PARA DIBUJAR EL FONDO CON EL RENDERIZADOR DE SDL
+void OrbitBackground::draw(SDL_Renderer* renderer) const {
+    if (texture != nullptr) {
+        SDL_RenderCopy(renderer, texture, nullptr, nullptr); // COPIAR EL FONDO
+        return;
+    }
+
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); // COLOR DE FONDO
+    SDL_RenderClear(renderer); // LIMPIAR PANTALLA
+    SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255); // COLOR
+    SDL_RenderDrawPoints(renderer, ringPoints.data(), static_cast<int>(ringPoints.size()));
+}
+
+// FUNCION PARA DESTRUIR LA TEXTURA (ANTES DE DESTRUIR EL RENDERIZADOR)
+void OrbitBackground::destroy() {
+    if (texture != nullptr) {
+        SDL_DestroyTexture(texture); // DESTRUIR TEXTURA
+        texture = nullptr;
+    }
+}
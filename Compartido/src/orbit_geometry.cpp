@@ -0,0 +1,24 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "orbit_geometry.h" // Include orbit geometry header
+#include "random.h" // Include counter based random header
+
+// FUNCION PARA CREAR LAS ORBITAS
+OrbitGeometry makeOrbitLayout(int count, int width, int height, uint64_t seed) {
+    OrbitGeometry orbits;
+    orbits.x.reserve(count);
+    orbits.y.reserve(count);
+    orbits.radius.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        orbits.x.push_back(width * (i + 1) / (count + 1)); // COORDENADA X
+        orbits.y.push_back(height / 2 + (i % 2 == 0 ? -1 : 1) * height / 4); // COORDENADA Y
+        orbits.radius.push_back(50 + 100 * counterUniform(seed, i, 0, RNG_ORBIT_RADIUS)); // RADIO
+    }
+    return orbits;
+}
@@ -0,0 +1,67 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "quality_governor.h" // Include quality governor header
+#include <algorithm> // Include algorithm header
+
+QualityGovernor::QualityGovernor(double budgetMs, QualityLevels best, QualityLevels worst)
+    : budget(budgetMs), best(best), worst(worst), current(best) {}
+
+// FUNCION PARA REGISTRAR LA DURACION DE UN FRAME
+bool QualityGovernor::addFrame(double frameMs) {
+    windowSum += frameMs;
+    if (++windowFrames < WINDOW_FRAMES) return false;
+
+    lastAverage = windowSum / windowFrames;
+    windowSum = 0;
+    windowFrames = 0;
+    if (lastAverage > budget) return degrade();
+    if (lastAverage < budget * HEADROOM) return improve();
+    return false; // DENTRO DE LA BANDA: NO SE TOCA NADA
+}
+
+// FUNCION PARA BAJAR UN PASO DE CALIDAD (O SUBIR HILOS)
+bool QualityGovernor::degrade() {
+    if (current.threads < best.threads) {
+        current.threads++;
+        decision = "threads +1 (" + std::to_string(current.threads) + ")";
+        return true;
+    }
+    if (current.trailLength > worst.trailLength) {
+        current.trailLength = std::max(worst.trailLength, current.trailLength * 3 / 4);
+        decision = "trail -> " + std::to_string(current.trailLength);
+        return true;
+    }
+    if (current.particles > worst.particles) {
+        current.particles = std::max(worst.particles, current.particles * 4 / 5);
+        decision = "particles -> " + std::to_string(current.particles);
+        return true;
+    }
+    decision = "over budget at lowest quality";
+    return false;
+}
+
+// FUNCION PARA SUBIR UN PASO DE CALIDAD (O SOLTAR HILOS)
+bool QualityGovernor::improve() {
+    if (current.particles < best.particles) {
+        current.particles = std::min(best.particles, current.particles + std::max(1, current.particles / 10));
+        decision = "particles -> " + std::to_string(current.particles);
+        return true;
+    }
+    if (current.trailLength < best.trailLength) {
+        current.trailLength++;
+        decision = "trail -> " + std::to_string(current.trailLength);
+        return true;
+    }
+    if (current.threads > worst.threads) {
+        current.threads--;
+        decision = "threads -1 (" + std::to_string(current.threads) + ")";
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,145 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "rasterizer.h" // Include rasterizer header
+#include <cmath> // Include cmath header
+#include <algorithm> // Include algorithm header
+#include "execution_backend.h" // Include execution backend header
+#include "trace.h" // Include trace header
+
+namespace {
+
+// FUNCION PARA DIVIDIR ENTRE 255 CON REDONDEO (EXACTA PARA 0..65535)
+inline Uint32 div255(Uint32 v) {
+    v += 128;
+    return (v + (v >> 8)) >> 8;
+}
+
+// FUNCION PARA MEZCLAR src SOBRE dst USANDO EL ALFA DE src
+inline Uint32 blendOver(Uint32 dst, Uint32 src) {
+    Uint32 a = src >> 24; // ALFA
+    if (a == 255) return src;
+    Uint32 inv = 255 - a;
+    Uint32 r = div255(((src >> 16) & 0xFF) * a + ((dst >> 16) & 0xFF) * inv);
+    Uint32 g = div255(((src >> 8) & 0xFF) * a + ((dst >> 8) & 0xFF) * inv);
+    Uint32 b = div255((src & 0xFF) * a + (dst & 0xFF) * inv);
+    return 0xFF000000u | (r << 16) | (g << 8) | b;
+}
+
+} // namespace
+
+// FUNCION PARA LLENAR TODO EL FRAMEBUFFER CON UN COLOR
+void clearFrame(const FrameBuffer& fb, Uint32 color) {
+    parallelFor(fb.height, [&](size_t y, int) {
+        std::fill_n(fb.pixels + y * fb.pitch, fb.width, color);
+    });
+}
+
+// FUNCION PARA CALCULAR LOS 360 PUNTOS DEL ANILLO DE CADA ORBITA
+void buildOrbitRings(const OrbitGeometry& orbits, std::vector<SDL_Point>& points) {
+    // CIRCULO UNITARIO, SE CALCULA UNA SOLA VEZ
+    static float unitX[360], unitY[360];
+    static bool unitReady = false;
+    if (!unitReady) {
+        for (int i = 0; i < 360; i++) {
+            float angle = i * M_PI / 180; // ANGULO
+            unitX[i] = std::cos(angle);
+            unitY[i] = std::sin(angle);
+        }
+        unitReady = true;
+    }
+
+    points.clear();
+    points.reserve(orbits.size() * 360);
+    for (size_t k = 0; k < orbits.size(); ++k) {
+        for (int i = 0; i < 360; i++) {
+            int x = static_cast<int>(orbits.x[k] + orbits.radius[k] * unitX[i]); // COORDENADA X
+            int y = static_cast<int>(orbits.y[k] + orbits.radius[k] * unitY[i]); // COORDENADA Y
+            points.push_back({x, y});
+        }
+    }
+}
+
+// FUNCION PARA DIBUJAR LAS ORBITAS (360 PUNTOS GRISES CADA UNA)
+void rasterizeOrbits(const FrameBuffer& fb, const OrbitGeometry& orbits) {
+    std::vector<SDL_Point> points; // PUNTOS DE LOS ANILLOS
+    buildOrbitRings(orbits, points);
+
+    const Uint32 gray = packColor(100, 100, 100); // COLOR
+    for (const SDL_Point& point : points) {
+        if (point.x < 0 || point.x >= fb.width || point.y < 0 || point.y >= fb.height) continue;
+        fb.pixels[static_cast<size_t>(point.y) * fb.pitch + point.x] = gray; // DIBUJAR PUNTO
+    }
+}
+
+// FUNCION PARA DIBUJAR LAS ESTELAS DE TODAS LAS PARTICULAS
+void TrailRasterizer::draw(const FrameBuffer& fb, const ParticleSystem& ps, int trailLength, float blend) {
+    const int ranges = backendWorkers(); // RANGOS DE PARTICULAS, UNO POR TRABAJADOR
+    begin(fb, trailLength, ranges, blend);
+    if (bands == 0) return;
+
+    const size_t count = ps.size(); // CANTIDAD DE PARTICULAS
+
+    // 1. CLASIFICAR LOS PUNTOS DE CADA RANGO CONTIGUO DE PARTICULAS POR BANDA
+    parallelFor(ranges, [&](size_t range, int) {
+        binRange(ps, count * range / ranges, count * (range + 1) / ranges, static_cast<int>(range));
+    });
+
+    // 2. MEZCLAR CADA BANDA EN EL ORDEN ORIGINAL DE LAS PARTICULAS
+    parallelFor(bands, [&](size_t band, int) {
+        blendBand(static_cast<int>(band));
+    });
+}
+
+// FUNCION PARA PREPARAR UN DIBUJO POR PARTES
+void TrailRasterizer::begin(const FrameBuffer& fb, int trailLength, int ranges, float blend) {
+    target = fb;
+    trail = trailLength;
+    pointBlend = blend;
+    rangeCount = std::max(ranges, 1);
+    if (fb.width <= 0 || fb.height <= 0) {
+        bands = 0;
+        return;
+    }
+    // BANDAS DE FILAS: ALREDEDOR DE 4 POR RANGO PARA REPARTIR LA CARGA
+    rowsPerBand = std::max(8, fb.height / (rangeCount * 4));
+    bands = (fb.height + rowsPerBand - 1) / rowsPerBand;
+    bins.resize(static_cast<size_t>(rangeCount) * bands);
+    for (auto& bin : bins) bin.clear(); // CONSERVA LA MEMORIA ENTRE FRAMES
+}
+
+// FUNCION PARA CLASIFICAR POR BANDA LOS PUNTOS DE UN RANGO DE PARTICULAS
+void TrailRasterizer::binRange(const ParticleSystem& ps, size_t first, size_t last, int range) {
+    if (bands == 0) return;
+    TraceScope scope("trail_bin"); // CRONOMETRO DEL RANGO
+    const FrameBuffer& fb = target;
+    std::vector<Fragment>* myBins = &bins[static_cast<size_t>(range) * bands]; // BANDAS DEL RANGO
+    for (size_t i = first; i < last; ++i) {
+        const SDL_Color& color = ps.color[i]; // COLOR
+        // RECORRER LA ESTELA DEL PUNTO MAS NUEVO AL MAS VIEJO
+        const int points = std::min(ps.trailCount[i], trail); // PUNTOS QUE SE DIBUJAN
+        for (int t = 0; t < points; ++t) {
+            const SDL_Point point = ps.renderPoint(i, t, pointBlend); // PUNTO DE LA ESTELA
+            if (point.x < 0 || point.x >= fb.width || point.y < 0 || point.y >= fb.height) continue;
+            int alpha = 255 * (1 - static_cast<float>(t) / trail); // TRANSPARENCIA
+            myBins[point.y / rowsPerBand].push_back({
+                static_cast<Uint32>(point.y * fb.pitch + point.x),
+                packColor(color.r, color.g, color.b, static_cast<Uint8>(std::clamp(alpha, 0, 255)))});
+        }
+    }
+}
+
+// FUNCION PARA MEZCLAR UNA BANDA RECORRIENDO LOS RANGOS EN ORDEN
+void TrailRasterizer::blendBand(int band) {
+    TraceScope scope("trail_blend"); // CRONOMETRO DE LA BANDA
+    for (int range = 0; range < rangeCount; ++range) {
+        for (const Fragment& f : bins[static_cast<size_t>(range) * bands + band]) {
+            target.pixels[f.offset] = blendOver(target.pixels[f.offset], f.color);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "settings.h" // Include settings header
+#include "motion_kernel.h" // Include motion kernel header
+#include "execution_backend.h" // Include execution backend header
+#ifdef _OPENMP
+#include <omp.h> // Include OpenMP header
+#endif
+
+int SCREEN_WIDTH = 800; //  ANCHO DE LA PANTALLA
+int SCREEN_HEIGHT = 600;  // ALTO DE LA PANTALLA
+int INITIAL_PARTICLES = 5000; // CANTIDAD DE PARTICULAS INICIALES
+int TRAIL_LENGTH = 20; // LONGITUD DE LA ESTELA
+int NUM_ORBITS = 5; // CANTIDAD DE ORBITAS
+float ORBIT_SPEED = 0.02f; // VELOCIDAD DE LA ORBITA
+float ROAM_SPEED = 1.0f; // VELOCIDAD DE MOVIMIENTO
+float CAPTURE_RADIUS = 100.0f; // RADIO DE CAPTURA
+float ABSORPTION_RADIUS = 5.0f; // RADIO DE ABSORCION
+float ESCAPE_PROBABILITY = 0.005f; // PROBABILIDAD DE ESCAPE
+float CAPTURE_PROBABILITY = 0.05f; // PROBABILIDAD DE CAPTURA
+uint64_t SEED = 0; // SEMILLA DEL GENERADOR ALEATORIO
+int ORBIT_MOTION = ORBIT_MOTION_POLY; // CALCULO DEL SENO Y COSENO DE LA ORBITA
+int RENDER_MODE = RENDER_SOFTWARE; // FORMA DE DIBUJAR
+// BACKEND POR DEFECTO, CMAKE LO ESCOGE CON SCREENSAVER_DEFAULT_BACKEND
+#ifndef SCREENSAVER_DEFAULT_BACKEND
+#ifdef _OPENMP
+#define SCREENSAVER_DEFAULT_BACKEND BACKEND_OPENMP
+#else
+#define SCREENSAVER_DEFAULT_BACKEND BACKEND_SEQUENTIAL
+#endif
+#endif
+
+int BACKEND = SCREENSAVER_DEFAULT_BACKEND; // BACKEND DE EJECUCION
+int NUM_THREADS = 0; // HILOS DEL BACKEND (0: LOS QUE DECIDA EL SISTEMA)
+bool PIPELINE = false; // SIMULAR EL SIGUIENTE FRAME MIENTRAS SE DIBUJA EL ACTUAL
+int UPDATE_SCHEDULE = SCHEDULE_STATIC; // REPARTO DEL CICLO DE ACTUALIZACION
+int SCHEDULE_CHUNK = 0; // BLOQUES POR PEDAZO (0: EL VALOR POR DEFECTO DE OPENMP)
+float SIM_RATE = 60; // PASOS DE SIMULACION POR SEGUNDO (0: UN PASO POR FRAME)
+int MAX_SUBSTEPS = 4; // PASOS MAXIMOS POR FRAME, LOS DEMAS SE DESCARTAN
+float FRAME_BUDGET = 0; // PRESUPUESTO DEL FRAME EN ms PARA EL CONTROL DE CALIDAD (0: APAGADO)
+std::string TRACE_FILE; // ARCHIVO DE LA TRAZA (VACIO: SIN TRAZA)
+
+// FUNCION PARA OBTENER EL NOMBRE DE UN REPARTO
+const char* scheduleName(int schedule) {
+    switch (schedule) {
+        case SCHEDULE_DYNAMIC: return "dynamic";
+        case SCHEDULE_GUIDED: return "guided";
+        default: return "static";
+    }
+}
+
+// FUNCION PARA APLICAR --threads Y --schedule AL HILO QUE LLAMA
+void applyThreadSettings() {
+#ifdef _OPENMP
+    if (BACKEND != BACKEND_OPENMP) return;
+    if (NUM_THREADS > 0) {
+        omp_set_num_threads(NUM_THREADS); // HILOS PEDIDOS CON --threads
+    }
+    omp_sched_t kind = UPDATE_SCHEDULE == SCHEDULE_DYNAMIC ? omp_sched_dynamic
+                     : UPDATE_SCHEDULE == SCHEDULE_GUIDED ? omp_sched_guided
+                     : omp_sched_static;
+    omp_set_schedule(kind, SCHEDULE_CHUNK); // LO USA EL CICLO DE ACTUALIZACION (schedule(runtime))
+#endif
+}
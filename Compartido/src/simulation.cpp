@@ -0,0 +1,180 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "simulation.h" // Include simulation header
+#include <algorithm> // Include algorithm header
+#include <cmath> // Include cmath header
+#include "settings.h" // Include settings header
+#include "random.h" // Include counter based random header
+#include "motion_kernel.h" // Include motion kernel header
+#include "execution_backend.h" // Include execution backend header
+#include "trace.h" // Include trace header
+
+// REDUCCION DEL RADIO DE ORBITA POR FRAME
+constexpr float ORBIT_RADIUS_DECAY = 0.01f;
+
+// FUNCION PARA OBTENER UN COLOR ALEATORIO
+SDL_Color getRandomColor(uint64_t id, uint64_t frame, uint32_t stream) {
+    uint64_t bits = counterRandom(SEED, id, frame, stream); // BITS ALEATORIOS
+
+    return SDL_Color{static_cast<Uint8>(bits),
+                     static_cast<Uint8>(bits >> 8),
+                     static_cast<Uint8>(bits >> 16),
+                     255};
+}
+
+// FUNCION PARA INICIALIZAR LA POSICION i CON UNA PARTICULA NUEVA. EL
+// IDENTIFICADOR SALE DE LA POSICION Y SU GENERACION, ASI QUE NO DEPENDE DEL
+// ORDEN EN QUE LOS HILOS LLENAN EL POOL
+void spawnAt(ParticleSystem& ps, size_t i) {
+    const uint64_t id = particleId(i, ps.generation[i]); // LLAVE DEL GENERADOR ALEATORIO
+    float x = counterUniform(SEED, id, 0, RNG_SPAWN_X) * SCREEN_WIDTH; // COORDENADA X
+    float y = counterUniform(SEED, id, 0, RNG_SPAWN_Y) * SCREEN_HEIGHT; // COORDENADA Y
+    float dx = ROAM_SPEED * (counterUniform(SEED, id, 0, RNG_SPAWN_DX) * 2 - 1); // VELOCIDAD EN X
+    float dy = ROAM_SPEED * (counterUniform(SEED, id, 0, RNG_SPAWN_DY) * 2 - 1); // VELOCIDAD EN Y
+    ps.init(i, id, x, y, dx, dy, getRandomColor(id, 0, RNG_SPAWN_COLOR));
+}
+
+// FUNCION PARA AGREGAR PARTICULAS HASTA TENER target VIVAS
+size_t spawnParticles(ParticleSystem& ps, size_t target) {
+    target = std::min(target, ps.capacity);
+    if (ps.aliveCount >= target) return 0;
+
+    // ESCOGER LAS POSICIONES: PRIMERO LAS LIBERADAS (LA MAS RECIENTE PRIMERO)
+    // Y DESPUES NUEVAS AL FINAL DEL POOL
+    const size_t missing = target - ps.aliveCount; // PARTICULAS QUE FALTAN
+    const size_t reused = std::min(missing, ps.freeSlots.size()); // POSICIONES LIBERADAS A REUSAR
+    std::vector<uint32_t> slots(ps.freeSlots.end() - reused, ps.freeSlots.end()); // POSICIONES A LLENAR
+    std::reverse(slots.begin(), slots.end());
+    ps.freeSlots.resize(ps.freeSlots.size() - reused);
+    const size_t first = ps.grow(missing - reused); // PRIMERA POSICION NUEVA
+    for (size_t i = first; i < ps.size(); ++i) slots.push_back(static_cast<uint32_t>(i));
+    for (uint32_t slot : slots) {
+        if (slot < first) ps.generation[slot]++; // NUEVA PARTICULA EN UNA POSICION USADA
+        ps.markAlive(slot);
+    }
+
+    // CADA TRABAJADOR LLENA SUS BLOQUES SIN CANDADOS
+    const size_t blockCount = (missing + UPDATE_BLOCK_SIZE - 1) / UPDATE_BLOCK_SIZE; // BLOQUES A LLENAR
+    parallelFor(blockCount, [&](size_t b, int) {
+        const size_t end = std::min(missing, (b + 1) * UPDATE_BLOCK_SIZE); // FIN DEL BLOQUE
+        for (size_t k = b * UPDATE_BLOCK_SIZE; k < end; ++k) {
+            spawnAt(ps, slots[k]);
+        }
+    });
+    traceCount(COUNTER_SPAWNS, missing);
+    return missing;
+}
+
+// FUNCION PARA LIBERAR PARTICULAS HASTA TENER target VIVAS
+size_t releaseParticles(ParticleSystem& ps, size_t target) {
+    size_t released = 0; // PARTICULAS LIBERADAS
+    for (size_t i = ps.size(); i > 0 && ps.aliveCount > target; --i) {
+        if (!ps.isAlive(i - 1)) continue;
+        ps.release(i - 1);
+        released++;
+    }
+    return released;
+}
+
+// FUNCION PARA CHEQUEAR SI UNA PARTICULA LIBRE ES CAPTURADA POR UNA ORBITA
+// (DEVUELVE true SI LA CAPTURARON)
+static bool captureParticle(ParticleSystem& ps, size_t i, const OrbitGeometry& orbits,
+                            const OrbitGrid& grid, uint64_t frame) {
+    const uint64_t id = ps.id[i]; // LLAVE DEL GENERADOR ALEATORIO
+
+    // CHEQUEAR CAPTURA SOLO CONTRA LAS ORBITAS DE LAS CELDAS VECINAS. SE
+    // QUEDA LA DE MENOR INDICE QUE CAPTURE, IGUAL QUE AL RECORRERLAS TODAS
+    const float captureRadius2 = CAPTURE_RADIUS * CAPTURE_RADIUS; // RADIO DE CAPTURA AL CUADRADO
+    int captured = -1; // ORBITA QUE CAPTURA
+    float capturedDx = 0, capturedDy = 0, capturedDist2 = 0; // DIFERENCIA Y DISTANCIA A ESA ORBITA
+    grid.forEachNeighbour(ps.x[i], ps.y[i], [&](int j) {
+        if (captured != -1 && j > captured) return; // YA CAPTURO UNA DE MENOR INDICE
+        float dx = ps.x[i] - orbits.x[j]; // DIFERENCIA EN X
+        float dy = ps.y[i] - orbits.y[j]; // DIFERENCIA EN Y
+        float dist2 = dx*dx + dy*dy; // DISTANCIA AL CUADRADO
+        if (dist2 < captureRadius2 && counterUniform(SEED, id, frame, RNG_CAPTURE + j) < CAPTURE_PROBABILITY) {
+            captured = j;
+            capturedDx = dx;
+            capturedDy = dy;
+            capturedDist2 = dist2;
+        }
+    });
+    if (captured != -1) {
+        ps.state[i] = PARTICLE_ORBITING; // ESTA EN ORBITA
+        ps.orbitIndex[i] = captured; // INDICE DE ORBITA
+        ps.orbitRadius[i] = std::sqrt(capturedDist2); // RADIO DE ORBITA
+        ps.angle[i] = std::atan2(capturedDy, capturedDx); // ANGULO
+        // COSENO Y SENO INICIALES PARA LA ROTACION INCREMENTAL, SIN TRIGONOMETRIA
+        float invDistance = ps.orbitRadius[i] > 0 ? 1.0f / ps.orbitRadius[i] : 0.0f;
+        ps.orbitCos[i] = invDistance > 0 ? capturedDx * invDistance : 1.0f;
+        ps.orbitSin[i] = capturedDy * invDistance;
+        ps.color[i] = getRandomColor(id, frame, RNG_CAPTURE_COLOR);  // COLOR ALEATORIO
+    }
+    return captured != -1;
+}
+
+// FUNCION PARA ACTUALIZAR LAS PARTICULAS [begin, end). SE HACE EN TRES PASADAS
+// PARA QUE EL MOVIMIENTO, QUE ES LA PARTE MAS CARA, CORRA EN EL KERNEL SIMD
+size_t updateParticles(ParticleSystem& ps, size_t begin, size_t end, const OrbitGeometry& orbits,
+                       const OrbitGrid& grid, uint64_t frame, uint64_t* absorbed) {
+    TraceScope scope("update_block"); // CRONOMETRO DEL BLOQUE
+    // 1. CHEQUEAR PROBABILIDAD DE ESCAPE DE LAS QUE ORBITAN
+    for (size_t i = begin; i < end; ++i) {
+        if (ps.state[i] != PARTICLE_ORBITING) continue;
+        const uint64_t id = ps.id[i]; // LLAVE DEL GENERADOR ALEATORIO
+        if (counterUniform(SEED, id, frame, RNG_ESCAPE) < ESCAPE_PROBABILITY) {
+            ps.state[i] = PARTICLE_ESCAPING; // NO SE MUEVE EN ESTE FRAME
+            ps.dx[i] = ROAM_SPEED * (counterUniform(SEED, id, frame, RNG_ESCAPE_DX) * 2 - 1); // VELOCIDAD DE MOVIMIENTO
+            ps.dy[i] = ROAM_SPEED * (counterUniform(SEED, id, frame, RNG_ESCAPE_DY) * 2 - 1); // VELOCIDAD DE MOVIMIENTO
+        }
+    }
+
+    // 2. MOVER TODAS LAS PARTICULAS CON EL KERNEL SIMD
+    OrbitCenters centers{orbits.x.data(), orbits.y.data()}; // CENTROS DE LAS ORBITAS
+    MotionParams params{ORBIT_SPEED, ABSORPTION_RADIUS, ORBIT_RADIUS_DECAY,
+                        static_cast<float>(SCREEN_WIDTH), static_cast<float>(SCREEN_HEIGHT),
+                        ORBIT_MOTION, std::cos(ORBIT_SPEED), std::sin(ORBIT_SPEED)};
+    integrateMotion(ps, begin, end, centers, params);
+
+    // 3. CONTAR Y REINICIAR LAS ABSORBIDAS, CHEQUEAR CAPTURAS Y AGREGAR PUNTOS A LA ESTELA
+    size_t absorbedCount = 0; // PARTICULAS ABSORBIDAS
+    size_t escapedCount = 0, capturedCount = 0; // ESCAPES Y CAPTURAS (PARA LA TRAZA)
+    for (size_t i = begin; i < end; ++i) {
+        switch (ps.state[i]) {
+            case PARTICLE_DEAD:
+                // LA PARTICULA ABSORBIDA SE REINICIA EN SU LUGAR COMO UNA NUEVA
+                absorbed[ps.orbitIndex[i]]++;
+                absorbedCount++;
+                ps.generation[i]++;
+                spawnAt(ps, i);
+                continue; // LA NUEVA EMPIEZA SIN ESTELA
+            case PARTICLE_FREE:
+                continue; // POSICION LIBRE
+            case PARTICLE_ESCAPING:
+                ps.state[i] = PARTICLE_ROAMING; // YA NO ESTA EN ORBITA
+                escapedCount++;
+                break;
+            case PARTICLE_ROAMING:
+                capturedCount += captureParticle(ps, i, orbits, grid, frame);
+                break;
+            default:
+                break;
+        }
+
+        // AGREGAR PUNTO A LA ESTELA
+        ps.pushTrail(i, SDL_Point{static_cast<int>(ps.x[i]), static_cast<int>(ps.y[i])});
+    }
+
+    // LAS REINICIADAS CUENTAN COMO ABSORCIONES Y COMO PARTICULAS NUEVAS
+    traceCount(COUNTER_ESCAPES, escapedCount);
+    traceCount(COUNTER_CAPTURES, capturedCount);
+    traceCount(COUNTER_ABSORPTIONS, absorbedCount);
+    traceCount(COUNTER_SPAWNS, absorbedCount);
+    return absorbedCount;
+}
@@ -0,0 +1,228 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "snapshot.h" // Include snapshot header
+#include <algorithm> // Include algorithm header
+#include <cmath> // Include cmath header
+#include <cstring> // Include cstring header
+#include <fstream> // Include fstream header
+
+namespace {
+
+// ENCABEZADO DEL ARCHIVO: "SSNP" Y LA VERSION DEL FORMATO
+constexpr char SNAPSHOT_MAGIC[4] = {'S', 'S', 'N', 'P'};
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+// TAMANO MAXIMO DE LA PANTALLA (EL MISMO QUE ACEPTAN --width Y --height)
+constexpr int32_t SNAPSHOT_MAX_SIDE = 16384;
+
+// FUNCION PARA ESCRIBIR UN VALOR (EN EL ORDEN DE BYTES DE LA MAQUINA)
+template <typename T>
+void put(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// FUNCION PARA ESCRIBIR UN ARREGLO PRECEDIDO POR SU TAMANO
+template <typename T>
+void putArray(std::ostream& out, const std::vector<T>& values) {
+    put<uint64_t>(out, values.size());
+    out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+}
+
+// FUNCION PARA LEER UN VALOR
+template <typename T>
+bool get(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+// FUNCION PARA LEER UN ARREGLO PRECEDIDO POR SU TAMANO. UN ARREGLO NO PUEDE
+// SER MAS GRANDE QUE EL ARCHIVO (EVITA RESERVAR DE MAS CON UN ARCHIVO DANADO)
+template <typename T>
+bool getArray(std::istream& in, std::vector<T>& values, uint64_t fileBytes) {
+    uint64_t size = 0; // ELEMENTOS DEL ARREGLO
+    if (!get(in, size) || size > fileBytes / sizeof(T)) return false;
+    values.resize(size);
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(values.data()),
+                                     static_cast<std::streamsize>(size * sizeof(T))));
+}
+
+// FUNCION PARA COMPRIMIR LOS PIXELES EN PARES (REPETICIONES, COLOR); EL FONDO
+// ES NEGRO CASI TODO, ASI QUE QUEDA MUCHO MAS PEQUENO
+std::vector<uint32_t> encodeRuns(const std::vector<uint32_t>& pixels) {
+    std::vector<uint32_t> runs; // PARES (REPETICIONES, COLOR)
+    for (size_t i = 0; i < pixels.size();) {
+        size_t j = i + 1; // FIN DE LA CORRIDA
+        while (j < pixels.size() && pixels[j] == pixels[i] && j - i < UINT32_MAX) ++j;
+        runs.push_back(static_cast<uint32_t>(j - i));
+        runs.push_back(pixels[i]);
+        i = j;
+    }
+    return runs;
+}
+
+// FUNCION PARA DESCOMPRIMIR LOS PIXELES (false SI NO SUMAN count)
+bool decodeRuns(const std::vector<uint32_t>& runs, size_t count, std::vector<uint32_t>& pixels) {
+    if (runs.size() % 2 != 0) return false;
+    pixels.clear();
+    pixels.reserve(count);
+    for (size_t r = 0; r < runs.size(); r += 2) {
+        if (pixels.size() + runs[r] > count) return false;
+        pixels.insert(pixels.end(), runs[r], runs[r + 1]);
+    }
+    return pixels.size() == count;
+}
+
+} // namespace
+
+// FUNCION PARA TOMAR LA FOTO DE UN FRAME
+Snapshot captureSnapshot(const ParticleSystem& ps, const OrbitGeometry& orbits, const FrameBuffer* fb,
+                         uint64_t frame, uint64_t seed) {
+    Snapshot snapshot; // FOTO
+    snapshot.frame = frame;
+    snapshot.seed = seed;
+    snapshot.trailLength = ps.trailLength;
+    snapshot.orbitX = orbits.x;
+    snapshot.orbitY = orbits.y;
+    snapshot.orbitRadius = orbits.radius;
+
+    const size_t count = ps.size(); // POSICIONES DEL POOL
+    snapshot.id.assign(ps.id.begin(), ps.id.begin() + count);
+    snapshot.x.assign(ps.x.begin(), ps.x.begin() + count);
+    snapshot.y.assign(ps.y.begin(), ps.y.begin() + count);
+    snapshot.state.assign(ps.state.begin(), ps.state.begin() + count);
+    snapshot.orbitIndex.assign(ps.orbitIndex.begin(), ps.orbitIndex.begin() + count);
+    snapshot.color.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const SDL_Color& c = ps.color[i]; // COLOR
+        snapshot.color[i] = packColor(c.r, c.g, c.b, c.a);
+    }
+
+    if (fb != nullptr && fb->pixels != nullptr) {
+        snapshot.width = fb->width;
+        snapshot.height = fb->height;
+        snapshot.pixels.resize(static_cast<size_t>(fb->width) * fb->height);
+        for (int row = 0; row < fb->height; ++row) {
+            std::memcpy(snapshot.pixels.data() + static_cast<size_t>(row) * fb->width,
+                        fb->pixels + static_cast<size_t>(row) * fb->pitch, fb->width * sizeof(Uint32));
+        }
+    }
+    return snapshot;
+}
+
+// FUNCION PARA GUARDAR UNA FOTO
+bool writeSnapshot(const std::string& path, const Snapshot& snapshot) {
+    std::ofstream out(path, std::ios::binary); // ARCHIVO DE LA FOTO
+    if (!out) return false;
+    out.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    put(out, SNAPSHOT_VERSION);
+    put(out, snapshot.frame);
+    put(out, snapshot.seed);
+    put<int32_t>(out, snapshot.width);
+    put<int32_t>(out, snapshot.height);
+    put<int32_t>(out, snapshot.trailLength);
+    putArray(out, snapshot.orbitX);
+    putArray(out, snapshot.orbitY);
+    putArray(out, snapshot.orbitRadius);
+    putArray(out, snapshot.id);
+    putArray(out, snapshot.x);
+    putArray(out, snapshot.y);
+    putArray(out, snapshot.state);
+    putArray(out, snapshot.orbitIndex);
+    putArray(out, snapshot.color);
+    putArray(out, encodeRuns(snapshot.pixels));
+    return static_cast<bool>(out);
+}
+
+// FUNCION PARA LEER UNA FOTO
+bool readSnapshot(const std::string& path, Snapshot& snapshot) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate); // ARCHIVO DE LA FOTO
+    if (!in) return false;
+    const std::streamoff fileBytes = in.tellg(); // TAMANO DEL ARCHIVO
+    if (fileBytes < 0 || !in.seekg(0)) return false;
+    const uint64_t limit = static_cast<uint64_t>(fileBytes); // TAMANO MAXIMO DE UN ARREGLO
+    char magic[sizeof(SNAPSHOT_MAGIC)]; // ENCABEZADO
+    uint32_t version = 0; // VERSION DEL FORMATO
+    int32_t width = 0, height = 0, trailLength = 0; // TAMANOS
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0) return false;
+    if (!get(in, version) || version != SNAPSHOT_VERSION) return false;
+    if (!get(in, snapshot.frame) || !get(in, snapshot.seed) || !get(in, width) || !get(in, height) ||
+        !get(in, trailLength) || width < 0 || height < 0 || width > SNAPSHOT_MAX_SIDE || height > SNAPSHOT_MAX_SIDE) {
+        return false;
+    }
+    snapshot.width = width;
+    snapshot.height = height;
+    snapshot.trailLength = trailLength;
+
+    std::vector<uint32_t> runs; // PIXELES COMPRIMIDOS
+    if (!getArray(in, snapshot.orbitX, limit) || !getArray(in, snapshot.orbitY, limit) ||
+        !getArray(in, snapshot.orbitRadius, limit) || !getArray(in, snapshot.id, limit) ||
+        !getArray(in, snapshot.x, limit) || !getArray(in, snapshot.y, limit) || !getArray(in, snapshot.state, limit) ||
+        !getArray(in, snapshot.orbitIndex, limit) || !getArray(in, snapshot.color, limit) || !getArray(in, runs, limit)) {
+        return false;
+    }
+
+    // LOS ARREGLOS DE LAS ORBITAS Y LOS DE LAS PARTICULAS DEBEN TENER EL MISMO
+    // TAMANO ENTRE SI (SI NO, EL ARCHIVO ESTA DANADO); LOS PIXELES LOS REVISA decodeRuns
+    const size_t orbitCount = snapshot.orbitX.size(); // ORBITAS
+    const size_t particleCount = snapshot.x.size(); // PARTICULAS
+    if (snapshot.orbitY.size() != orbitCount || snapshot.orbitRadius.size() != orbitCount ||
+        snapshot.id.size() != particleCount || snapshot.y.size() != particleCount ||
+        snapshot.state.size() != particleCount || snapshot.orbitIndex.size() != particleCount ||
+        snapshot.color.size() != particleCount) {
+        return false;
+    }
+    return decodeRuns(runs, static_cast<size_t>(width) * height, snapshot.pixels);
+}
+
+// FUNCION PARA COMPARAR UNA FOTO CONTRA LA DE REFERENCIA
+SnapshotDiff compareSnapshots(const Snapshot& golden, const Snapshot& current, const GoldenTolerance& tolerance) {
+    SnapshotDiff diff; // DIFERENCIAS
+
+    // LO QUE NO TIENE TOLERANCIA: TAMANOS, ORBITAS Y CANTIDAD DE PARTICULAS
+    diff.layoutMatches = golden.width == current.width && golden.height == current.height &&
+                         golden.trailLength == current.trailLength && golden.seed == current.seed &&
+                         golden.orbitX == current.orbitX && golden.orbitY == current.orbitY &&
+                         golden.orbitRadius == current.orbitRadius && golden.x.size() == current.x.size() &&
+                         golden.pixels.size() == current.pixels.size();
+    if (!diff.layoutMatches) {
+        diff.passed = false;
+        return diff;
+    }
+
+    // PARTICULAS: MISMO IDENTIFICADOR, ESTADO, ORBITA Y COLOR, Y POSICION CERCANA
+    for (size_t i = 0; i < golden.x.size(); ++i) {
+        float error = std::max(std::fabs(golden.x[i] - current.x[i]), std::fabs(golden.y[i] - current.y[i]));
+        if (!(error <= tolerance.position) || golden.id[i] != current.id[i] || golden.state[i] != current.state[i] ||
+            golden.orbitIndex[i] != current.orbitIndex[i] || golden.color[i] != current.color[i]) {
+            diff.particlesOff++;
+        }
+        if (std::isfinite(error)) diff.maxPositionError = std::max(diff.maxPositionError, error);
+    }
+
+    // PIXELES: LA MAYOR DIFERENCIA ENTRE CANALES
+    for (size_t p = 0; p < golden.pixels.size(); ++p) {
+        int worst = 0; // MAYOR DIFERENCIA DEL PIXEL
+        for (int shift = 0; shift < 32; shift += 8) {
+            int a = (golden.pixels[p] >> shift) & 0xFF;
+            int b = (current.pixels[p] >> shift) & 0xFF;
+            worst = std::max(worst, std::abs(a - b));
+        }
+        if (worst > tolerance.channel) diff.pixelsOff++;
+        diff.maxChannelError = std::max(diff.maxChannelError, worst);
+    }
+
+    const double particleFraction = golden.x.empty() ? 0 : static_cast<double>(diff.particlesOff) / golden.x.size();
+    const double pixelFraction = golden.pixels.empty() ? 0 : static_cast<double>(diff.pixelsOff) / golden.pixels.size();
+    diff.passed = particleFraction <= tolerance.maxDiff && pixelFraction <= tolerance.maxDiff;
+    return diff;
+}
+
+// FUNCION PARA OBTENER EL NOMBRE DEL ARCHIVO DE LA FOTO DE UN FRAME
+std::string snapshotPath(const std::string& directory, uint64_t frame) {
+    return directory + "/frame_" + std::to_string(frame) + ".snap";
+}
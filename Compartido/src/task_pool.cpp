@@ -0,0 +1,190 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "task_pool.h" // Include task pool header
+#include <algorithm> // Include algorithm header
+#include <utility> // Include utility header
+
+namespace {
+
+// HILO DEL POOL QUE CORRE EL HILO ACTUAL (-1 SI NO ES DE NINGUN POOL)
+thread_local const void* currentPool = nullptr;
+thread_local int currentWorker = -1;
+
+} // namespace
+
+// FUNCION PARA AGREGAR UNA TAREA
+int TaskGraph::add(Work work) {
+    works.push_back(std::move(work));
+    successors.emplace_back();
+    dependencies.push_back(0);
+    return static_cast<int>(works.size() - 1);
+}
+
+// FUNCION PARA QUE after CORRA HASTA QUE TERMINE before
+void TaskGraph::depend(int after, int before) {
+    successors[before].push_back(after);
+    dependencies[after]++;
+}
+
+// FUNCION PARA VACIAR EL GRAFO
+void TaskGraph::clear() {
+    works.clear();
+    successors.clear();
+    dependencies.clear();
+}
+
+TaskPool::TaskPool(int workers) : queues(workers > 0 ? workers : 1) {
+    active = static_cast<int>(queues.size());
+    for (int w = 0; w < static_cast<int>(queues.size()); ++w) {
+        threads.emplace_back(&TaskPool::workerLoop, this, w);
+    }
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& thread : threads) thread.join();
+}
+
+// FUNCION PARA LIMITAR LOS HILOS QUE TOMAN TAREAS
+void TaskPool::setActive(int count) {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        active = std::clamp(count, 1, workers());
+    }
+    wake.notify_all();
+}
+
+// FUNCION PARA CORRER UN GRAFO Y ESPERAR A QUE TERMINE
+void TaskPool::run(TaskGraph& graph) {
+    const size_t count = graph.size(); // TAREAS DEL GRAFO
+    if (count == 0) return;
+
+    Run run; // ESTADO DE ESTA CORRIDA
+    run.graph = &graph;
+    run.pending = std::make_unique<std::atomic<int>[]>(count);
+    run.remaining = count;
+    for (size_t t = 0; t < count; ++t) {
+        run.pending[t] = graph.dependencies[t];
+    }
+
+    // REPARTIR LAS TAREAS SIN DEPENDENCIAS. DESDE UN HILO DEL POOL VAN A SU
+    // PROPIA COLA; DESDE AFUERA SE REPARTEN ENTRE TODAS
+    const bool inside = currentPool == this; // LO LLAMA UN HILO DE ESTE POOL
+    for (size_t t = 0; t < count; ++t) {
+        if (graph.dependencies[t] != 0) continue;
+        int queue = inside ? currentWorker : nextQueue.fetch_add(1, std::memory_order_relaxed) % activeWorkers();
+        push(queue, {&run, static_cast<int>(t)});
+    }
+
+    if (inside) {
+        // UN HILO DEL POOL NO SE PUEDE DORMIR: CORRE TAREAS MIENTRAS ESPERA
+        Ready ready; // TAREA A CORRER
+        while (run.remaining.load(std::memory_order_acquire) > 0) {
+            if (take(currentWorker, ready)) {
+                execute(currentWorker, ready);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        // ESPERAR A QUE execute SUELTE EL CANDADO DE LA CORRIDA
+        std::unique_lock<std::mutex> lock(run.mutex);
+        run.finished.wait(lock, [&run] { return run.done; });
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(run.mutex);
+    run.finished.wait(lock, [&run] { return run.done; });
+}
+
+// FUNCION PARA METER UNA TAREA LISTA EN LA COLA DE UN HILO
+void TaskPool::push(int queue, Ready ready) {
+    {
+        std::lock_guard<std::mutex> lock(queues[queue].mutex);
+        queues[queue].tasks.push_back(ready);
+    }
+    queued.fetch_add(1, std::memory_order_release);
+    // TOMAR EL CANDADO DEL SUENO EVITA DESPERTAR A UN HILO QUE AUN NO SE DUERME
+    { std::lock_guard<std::mutex> lock(sleepMutex); }
+    // CON HILOS INACTIVOS SE DESPIERTA A TODOS: EL AVISO PODRIA LLEGARLE A UNO
+    // INACTIVO, QUE SE VUELVE A DORMIR SIN TOMAR LA TAREA
+    if (activeWorkers() < workers()) {
+        wake.notify_all();
+    } else {
+        wake.notify_one();
+    }
+}
+
+// FUNCION PARA TOMAR UNA TAREA
+bool TaskPool::take(int worker, Ready& ready) {
+    // 1. LA MAS NUEVA DE LA COLA PROPIA
+    {
+        Queue& own = queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            ready = own.tasks.back();
+            own.tasks.pop_back();
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    // 2. ROBAR LA MAS VIEJA DE OTRA COLA, EMPEZANDO POR LA SIGUIENTE
+    const int count = workers(); // CANTIDAD DE COLAS
+    for (int k = 1; k < count; ++k) {
+        Queue& victim = queues[(worker + k) % count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            ready = victim.tasks.front();
+            victim.tasks.pop_front();
+            queued.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+// FUNCION PARA CORRER UNA TAREA Y LIBERAR LAS QUE LA ESPERABAN
+void TaskPool::execute(int worker, const Ready& ready) {
+    Run& run = *ready.run;
+    run.graph->works[ready.task](worker);
+
+    // LAS QUE QUEDAN LISTAS VAN A LA COLA PROPIA, SUS DATOS ESTAN EN ESTA CACHE
+    for (int next : run.graph->successors[ready.task]) {
+        if (run.pending[next].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            push(worker, {&run, next});
+        }
+    }
+
+    if (run.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(run.mutex);
+        run.done = true;
+        run.finished.notify_all();
+    }
+}
+
+// CICLO DE CADA HILO DEL POOL
+void TaskPool::workerLoop(int worker) {
+    currentPool = this;
+    currentWorker = worker;
+    Ready ready; // TAREA A CORRER
+    while (true) {
+        if (worker < activeWorkers() && take(worker, ready)) {
+            execute(worker, ready);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this, worker] {
+            return stopping || (worker < activeWorkers() && queued.load(std::memory_order_acquire) > 0);
+        });
+        if (stopping) return;
+    }
+}
@@ -0,0 +1,149 @@
+/**
+ * Universidad del Valle de Guatemala
+ * Programación Paralela y Distribuida sección 10
+ * Abner Ivan Garcia Alegria 21285
+ * Oscar Esteban Donis Martinez 21610
+ * Proyecto 1
+ */
+
+#include "trace.h" // Include trace header
+#include <fstream> // Include fstream header
+#include <iomanip> // Include iomanip header
+#include <iostream> // Include iostream header
+#include <memory> // Include memory header
+#include <mutex> // Include mutex header
+#include <vector> // Include vector header
+
+std::atomic<bool> traceActive{false};
+
+namespace {
+
+// INTERVALO ANOTADO POR UN HILO
+struct TraceEvent {
+    const char* name; // NOMBRE DEL INTERVALO (nullptr: CONTADORES DEL FRAME)
+    int64_t start; // INICIO, EN ns DESDE QUE EMPEZO LA TRAZA
+    int64_t duration; // DURACION EN ns (O NUMERO DE FRAME PARA LOS CONTADORES)
+    uint64_t counters[COUNTER_COUNT]; // VALORES DE LOS CONTADORES DEL FRAME
+};
+
+// BUFFER CIRCULAR DE UN HILO. SOLO LO ESCRIBE SU HILO; LOS CONTADORES SON
+// ATOMICOS PORQUE EL HILO PRINCIPAL LOS VACIA AL FINAL DE CADA FRAME
+struct ThreadBuffer {
+    int id; // NUMERO DEL HILO EN LA TRAZA
+    std::vector<TraceEvent> events; // EVENTOS (CIRCULAR)
+    size_t written = 0; // EVENTOS ESCRITOS EN TOTAL
+    std::atomic<uint64_t> counters[COUNTER_COUNT] = {}; // CONTADORES DESDE EL ULTIMO FRAME
+};
+
+std::mutex registryMutex; // PROTEGE buffers
+std::vector<std::unique_ptr<ThreadBuffer>> buffers; // BUFFERS DE TODOS LOS HILOS
+std::chrono::steady_clock::time_point origin; // INICIO DE LA TRAZA
+thread_local ThreadBuffer* localBuffer = nullptr; // BUFFER DEL HILO ACTUAL
+
+// FUNCION PARA OBTENER EL BUFFER DEL HILO ACTUAL (SE CREA LA PRIMERA VEZ)
+ThreadBuffer& threadBuffer() {
+    if (localBuffer == nullptr) {
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->events.resize(TRACE_EVENTS_PER_THREAD);
+        std::lock_guard<std::mutex> lock(registryMutex);
+        buffer->id = static_cast<int>(buffers.size());
+        localBuffer = buffer.get();
+        buffers.push_back(std::move(buffer));
+    }
+    return *localBuffer;
+}
+
+// FUNCION PARA ANOTAR UN EVENTO EN EL BUFFER DEL HILO
+void push(const TraceEvent& event) {
+    ThreadBuffer& buffer = threadBuffer();
+    buffer.events[buffer.written % buffer.events.size()] = event;
+    buffer.written++;
+}
+
+// FUNCION PARA CONVERTIR ns A LOS us DEL FORMATO
+double micros(int64_t nanos) {
+    return nanos / 1000.0;
+}
+
+} // namespace
+
+// FUNCION PARA EMPEZAR A GRABAR
+void traceEnable() {
+    origin = std::chrono::steady_clock::now();
+    threadBuffer(); // EL HILO PRINCIPAL ES EL PRIMERO
+    traceActive.store(true, std::memory_order_release);
+}
+
+// FUNCION PARA ANOTAR UN INTERVALO DEL HILO ACTUAL
+void traceRecord(const char* name, std::chrono::steady_clock::time_point start,
+                 std::chrono::steady_clock::time_point end) {
+    TraceEvent event{name, std::chrono::duration_cast<std::chrono::nanoseconds>(start - origin).count(),
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(), {}};
+    push(event);
+}
+
+// FUNCION PARA SUMAR A UN CONTADOR DEL HILO ACTUAL
+void traceCount(TraceCounter counter, uint64_t amount) {
+    if (!traceEnabled() || amount == 0) return;
+    threadBuffer().counters[counter].fetch_add(amount, std::memory_order_relaxed);
+}
+
+// FUNCION PARA JUNTAR LOS CONTADORES DE TODOS LOS HILOS
+void traceFrameEnd(uint64_t frame) {
+    if (!traceEnabled()) return;
+    TraceEvent event{nullptr, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - origin).count(),
+                     static_cast<int64_t>(frame), {}};
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (auto& buffer : buffers) {
+            for (int c = 0; c < COUNTER_COUNT; ++c) {
+                event.counters[c] += buffer->counters[c].exchange(0, std::memory_order_relaxed);
+            }
+        }
+    }
+    push(event);
+}
+
+// FUNCION PARA ESCRIBIR LA TRAZA
+bool traceWrite(const std::string& path) {
+    traceActive.store(false, std::memory_order_release);
+    std::ofstream out(path); // ARCHIVO DE LA TRAZA
+    if (!out) {
+        std::cerr << "No se pudo abrir " << path << "\n";
+        return false;
+    }
+
+    static const char* COUNTER_NAMES[COUNTER_COUNT] = {"captures", "escapes", "absorptions", "spawns"};
+    std::lock_guard<std::mutex> lock(registryMutex);
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool first = true; // PRIMER EVENTO (SIN COMA ANTES)
+    for (const auto& buffer : buffers) {
+        // NOMBRE DE LA FILA DEL HILO
+        out << (first ? "" : ",\n") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": "
+            << buffer->id << ", \"args\": {\"name\": \""
+            << (buffer->id == 0 ? std::string("main") : "worker " + std::to_string(buffer->id)) << "\"}}";
+        first = false;
+
+        // SOLO QUEDAN LOS ULTIMOS EVENTOS SI EL BUFFER DIO LA VUELTA
+        const size_t capacity = buffer->events.size(); // TAMANO DEL BUFFER
+        const size_t begin = buffer->written > capacity ? buffer->written - capacity : 0; // EVENTO MAS VIEJO
+        for (size_t k = begin; k < buffer->written; ++k) {
+            const TraceEvent& event = buffer->events[k % capacity];
+            if (event.name != nullptr) {
+                out << ",\n{\"name\": \"" << event.name << "\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << buffer->id
+                    << ", \"ts\": " << micros(event.start) << ", \"dur\": " << micros(event.duration) << "}";
+            } else {
+                out << ",\n{\"name\": \"frame\", \"ph\": \"C\", \"pid\": 1, \"tid\": " << buffer->id
+                    << ", \"ts\": " << micros(event.start) << ", \"args\": {";
+                for (int c = 0; c < COUNTER_COUNT; ++c) {
+                    out << (c > 0 ? ", " : "") << "\"" << COUNTER_NAMES[c] << "\": " << event.counters[c];
+                }
+                out << "}}";
+            }
+        }
+    }
+    out << "\n]}\n";
+    return true;
+}